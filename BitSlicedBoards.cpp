@@ -0,0 +1,116 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "BitSlicedBoards.h"
+#include "PegBoard.h"
+
+/// <summary>
+/// Constructor.  Takes the move table from the geometry, which must outlive the batch, and starts with an empty batch.
+/// </summary>
+/// <param name="geometry">Geometry of the boards</param>
+BitSlicedBoards::BitSlicedBoards(const Geometry *geometry) {
+	numberOfHoles = geometry->GetNumberOfHoles();
+	numberOfMoves = geometry->GetNumberOfMoves();
+	moves = geometry->GetMoves();
+	moveMask = geometry->GetMoveMasks();
+	Load(NULL, 0);
+}
+
+/// <summary>
+/// BitSlicedBoards::Load() transposes up to BITSLICE_BOARDS packed boards into the batch.  Board b of the batch is keys[b].
+/// </summary>
+/// <param name="keys">Packed boards (see Board::GetKey())</param>
+/// <param name="n">Number of boards, at most BITSLICE_BOARDS</param>
+void BitSlicedBoards::Load(const typeBoardKey *keys, int n) {
+	if (n > BITSLICE_BOARDS)
+		n = BITSLICE_BOARDS;
+	numBoards = n;
+
+	for (int i = 0; i < numberOfHoles; i++)
+		for (int w = 0; w < BITSLICE_WORDS; w++)
+			holes[i][w] = 0;
+	for (int w = 0; w < BITSLICE_WORDS; w++)
+		active[w] = 0;
+
+	for (int b = 0; b < n; b++) {
+		unsigned long long bit = 1ULL << (b % 64);
+		typeBoardKey key = keys[b];
+		active[b / 64] |= bit;
+		for (int i = 0; i < numberOfHoles; i++) {
+			if ((key >> i) & 1)
+				holes[i][b / 64] |= bit;
+		}
+	}
+}
+
+/// <summary>
+/// BitSlicedBoards::GetNumberOfBoards() returns the number of boards in the batch.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int BitSlicedBoards::GetNumberOfBoards(void) {
+	return numBoards;
+}
+
+/// <summary>
+/// BitSlicedBoards::GetNumberOfMoves() returns the number of moves of the geometry, i.e. the valid move indices of LegalMoves().
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int BitSlicedBoards::GetNumberOfMoves(void) {
+	return numberOfMoves;
+}
+
+/// <summary>
+/// BitSlicedBoards::GetMoveMask() returns the holes changed by move m.  XOR-ing it into a packed board on which m is legal performs the move.
+/// </summary>
+/// <param name="m">Index of the move in the geometry</param>
+/// <returns>Packed mask of the from, jump and to holes</returns>
+typeBoardKey BitSlicedBoards::GetMoveMask(int m) {
+	return moveMask[m];
+}
+
+/// <summary>
+/// BitSlicedBoards::LegalMoves() evaluates move m on every board of the batch: from and jump Full, to Empty.
+/// </summary>
+/// <param name="m">Index of the move in the geometry</param>
+/// <param name="legal">Receives the boards on which the move is legal</param>
+void BitSlicedBoards::LegalMoves(int m, typeBoardMask legal) {
+	const unsigned long long *from = holes[moves[m].from];
+	const unsigned long long *jump = holes[moves[m].jump];
+	const unsigned long long *to = holes[moves[m].to];
+	for (int w = 0; w < BITSLICE_WORDS; w++)
+		legal[w] = from[w] & jump[w] & ~to[w] & active[w];
+}
+
+/// <summary>
+/// BitSlicedBoards::Solved() finds the boards with exactly one peg (see PegBoard::isSolved()).
+/// A running "at least one" and "at least two" mask are accumulated over the holes.
+/// </summary>
+/// <param name="solved">Receives the solved boards</param>
+void BitSlicedBoards::Solved(typeBoardMask solved) {
+	typeBoardMask one, two;
+	for (int w = 0; w < BITSLICE_WORDS; w++)
+		one[w] = two[w] = 0;
+	for (int i = 0; i < numberOfHoles; i++) {
+		for (int w = 0; w < BITSLICE_WORDS; w++) {
+			two[w] |= one[w] & holes[i][w];
+			one[w] |= holes[i][w];
+		}
+	}
+	for (int w = 0; w < BITSLICE_WORDS; w++)
+		solved[w] = one[w] & ~two[w] & active[w];
+}
@@ -0,0 +1,50 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include "PegBoard.h"
+
+#define BITSLICE_WORDS 4	// 64-bit words per hole; 4 words (256 boards) fill an AVX2 register when built with -mavx2
+#define BITSLICE_BOARDS (64 * BITSLICE_WORDS)	// boards evaluated at once
+
+// A mask with one bit per board of a BitSlicedBoards batch (board b is bit b % 64 of word b / 64)
+typedef unsigned long long typeBoardMask[BITSLICE_WORDS];
+
+// BitSlicedBoards holds a batch of up to BITSLICE_BOARDS boards transposed so that each hole is one mask: bit b of holes[i] is set when board b has a peg in hole i.
+// Move legality and the one-peg check then become a handful of bitwise operations that cover every board of the batch at once,
+// instead of one PegBoard::ValidMove() call per board per move.
+class BitSlicedBoards
+{
+private:
+	typeBoardMask holes[MAX_NUMBER_OF_PEGS];
+	typeBoardMask active;	// boards present in the batch
+	int numBoards = 0;
+	int numberOfHoles;
+	int numberOfMoves;
+	const Move *moves;	// the geometry's moves
+	const typeBoardKey *moveMask;	// holes changed by each move (see GetMoveMask())
+
+public:
+	BitSlicedBoards(const Geometry *geometry = &Geometry::Standard());
+
+	void Load(const typeBoardKey *keys, int n);
+	int GetNumberOfBoards(void);
+	int GetNumberOfMoves(void);
+	typeBoardKey GetMoveMask(int m);
+
+	void LegalMoves(int m, typeBoardMask legal);
+	void Solved(typeBoardMask solved);
+};
@@ -15,6 +15,7 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <iostream>
+#include <bit>
 #include "Board.h"
 
 /// <summary>
@@ -23,7 +24,7 @@
 /// <param name="pos">Position to Query</param>
 /// <returns>PEGSTATUS associated with the specified position</returns>
 PEGSTATUS Board::GetPeg(int pos) {
-	return (PEGSTATUS) Pegs[pos];
+	return (PEGSTATUS) ((Pegs >> pos) & 1);
 }
 
 /// <summary>
@@ -32,7 +33,10 @@ PEGSTATUS Board::GetPeg(int pos) {
 /// <param name="pos">Position on the board to be set</param>
 /// <param name="val">PEGSTATUS value to set</param>
 void Board::SetPeg(int pos, PEGSTATUS val) {
-	Pegs[pos] = val;
+	if (val == Full)
+		setFull(pos);
+	else
+		setEmpty(pos);
 }
 
 /// <summary>
@@ -40,7 +44,7 @@ void Board::SetPeg(int pos, PEGSTATUS val) {
 /// </summary>
 /// <param name="pos">Position of the board to be set to FULL></param>
 void Board::setFull(int pos) {
-	Pegs[pos] = Full;
+	Pegs |= ((typeBoardKey)1 << pos);
 }
 
 /// <summary>
@@ -48,7 +52,7 @@ void Board::setFull(int pos) {
 /// </summary>
 /// <param name="pos">Position of the board to be set to FULL></param>
 void Board::setEmpty(int pos) {
-	Pegs[pos] = Empty;
+	Pegs &= ~((typeBoardKey)1 << pos);
 }
 
 /// <summary>
@@ -84,13 +88,40 @@ int Board::GetStartingVacancy(void) {
 	return StartingVacancy;
 }
 
+/// <summary>
+/// Board::GetNumberOfHoles() returns the number of holes of the board, set by Board::Initialize().
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int Board::GetNumberOfHoles(void) {
+	return NumberOfHoles;
+}
+
+/// <summary>
+/// Board::GetKey() packs the board into a typeBoardKey (bit i is set when position i is Full).  Used to hash, compare, and transmit boards cheaply.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Packed representation of the board</returns>
+typeBoardKey Board::GetKey(void) {
+	return Pegs;
+}
+
+/// <summary>
+/// Board::SetKey() is the reverse of Board::GetKey().  It sets every board position from a packed key and updates NumberOfRemainingPegs.
+/// </summary>
+/// <param name="key">Packed board to unpack</param>
+void Board::SetKey(typeBoardKey key) {
+	Pegs = key;
+	NumberOfRemainingPegs = std::popcount(key);
+}
+
 /// <summary>
 /// Board::isEmpty() checks if the specified board position is Empty
 /// </summary>
 /// <param name="pos">Position to be Queried</param>
 /// <returns>Returns true/false if the board position is Empty/Full</returns>
 bool Board::isEmpty(int pos) {
-	return (Pegs[pos] == Empty);
+	return (((Pegs >> pos) & 1) == 0);
 }
 
 /// <summary>
@@ -99,7 +130,7 @@ bool Board::isEmpty(int pos) {
 /// <param name="pos">Position to be Queried</param>
 /// <returns>Returns true/false if the board position is Full/Empty</returns>
 bool Board::isFull(int pos) {
-	return (Pegs[pos] == Full);
+	return (((Pegs >> pos) & 1) != 0);
 }
 
 /// <summary>
@@ -108,24 +139,20 @@ bool Board::isFull(int pos) {
 /// <param name="p">Board to be compared to</param>
 /// <returns></returns>
 bool Board::isEqual(Board p) {
-	bool r = true;
-	int i = 0;
-	while ((i < NUMBER_OF_PEGS) && (r)) {
-		r = (Pegs[i] == p.Pegs[i]);
-		i++;
-	}
-	return r;
+	return (Pegs == p.Pegs);
 }
 
 /// <summary>
 /// Board::Initialize() initializes the board to a configuration wherein every board position is full except for the specified starting vacancy
 /// </summary>
 /// <param name="emptyPeg"></param>
-void Board::Initialize(int startingVacancy) {
-	for (int i = 0; i < NUMBER_OF_PEGS; i++)
-		Pegs[i] = Full;
-	Pegs[startingVacancy] = Empty;
+/// <param name="numberOfHoles">Holes of the board's geometry, at most MAX_NUMBER_OF_PEGS</param>
+void Board::Initialize(int startingVacancy, int numberOfHoles) {
+	NumberOfHoles = numberOfHoles;
+	Pegs = (NumberOfHoles == MAX_NUMBER_OF_PEGS) ? ~(typeBoardKey)0 : (((typeBoardKey)1 << NumberOfHoles) - 1);
+	setEmpty(startingVacancy);
 	StartingVacancy = startingVacancy;
+	NumberOfRemainingPegs = NumberOfHoles - 1;
 }
 
 /// <summary>
@@ -134,10 +161,7 @@ void Board::Initialize(int startingVacancy) {
 /// <param name=""></param>
 /// <returns>Number of Pegs on the board</returns>
 int Board::RemainingPegs(void) {
-	int r = 0;
-	for (int i = 0; i < NUMBER_OF_PEGS; i++)
-		r += (int) Pegs[i];
-	return r;
+	return std::popcount(Pegs);
 }
 
 /// <summary>
@@ -145,8 +169,8 @@ int Board::RemainingPegs(void) {
 /// </summary>
 /// <param name=""></param>
 void Board::ShowBoard(void) {
-	for (int i = 0; i < NUMBER_OF_PEGS; i++) {
-		if (Pegs[i] == Full)
+	for (int i = 0; i < NumberOfHoles; i++) {
+		if (isFull(i))
 			std::cout << "Full ";
 		else
 			std::cout << "Empty ";
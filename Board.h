@@ -15,14 +15,19 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
-#define NUMBER_OF_PEGS 15
+#define NUMBER_OF_PEGS 15	// holes of the standard (5-row triangle) board
+#define MAX_NUMBER_OF_PEGS 64	// holes that fit in a typeBoardKey
+
+// typeBoardKey packs a board into a single word: bit i is set when position i is Full
+typedef unsigned long long typeBoardKey;
 
 enum PEGSTATUS { Empty = 0, Full = 1 };
 
 class Board
 {
 private:
-	PEGSTATUS Pegs[NUMBER_OF_PEGS];
+	typeBoardKey Pegs = 0;	// bit i is set when position i is Full (the board is its own key)
+	int NumberOfHoles = NUMBER_OF_PEGS;	// holes of the board's geometry (see Geometry)
 	int NumberOfRemainingPegs = NUMBER_OF_PEGS;	// keeps track of the number of pegs on the board (replacement for RemainingPegs())
 	int StartingVacancy; // keeps track of the starting vacancy of the board
 
@@ -36,13 +41,16 @@ public:
 	int GetNumberOfRemainingPegs(void);
 	void SetNumberOfRemainingPegs(int n);
 	int GetStartingVacancy(void);
+	int GetNumberOfHoles(void);
+	typeBoardKey GetKey(void);
+	void SetKey(typeBoardKey key);
 
 
 	bool isEmpty(int pos);
 	bool isFull(int pos);
 	bool isEqual(Board p);
 	
-	void Initialize(int emptyPeg);
+	void Initialize(int emptyPeg, int numberOfHoles = NUMBER_OF_PEGS);
 	int RemainingPegs(void);
 	void ShowBoard(void);
 		
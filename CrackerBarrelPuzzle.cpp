@@ -17,8 +17,16 @@
 
  #include <iostream>
 #include <ctime>
+#include <chrono>
+#include <ranges>
+#include <set>
+#include <vector>
+#include <bit>
 #include "PegBoard.h"
 #include "PegBoardSolver.h"
+#include "PegBoardShardedSolver.h"
+#include "PegBoardEstimator.h"
+#include "BitSlicedBoards.h"
 
 /// <summary>
 /// timeAllSolutionsOneBoard() is a helper function that executes and times the solution for a board with a specified starting vacancy.
@@ -27,7 +35,7 @@
 /// <param name="myBoard">Board to be Solved</param>
 /// <param name="solver">Solver to Employ</param>
 /// <param name="emptyPeg">Starting Vacancy</param>
-void timeAllSolutionsOneBoard(PegBoard myBoard, PegBoardSolver solver, int emptyPeg) {
+void timeAllSolutionsOneBoard(PegBoard myBoard, PegBoardSolver &solver, int emptyPeg) {
     std::clock_t c_start, c_end;
     double duration;
 
@@ -48,7 +56,7 @@ void timeAllSolutionsOneBoard(PegBoard myBoard, PegBoardSolver solver, int empty
 /// <param name="myBoard">Board to be Solved</param>
 /// <param name="solver">Solver to Employ</param>
 /// <param name="emptyPeg">Starting Vacancy</param>
-void timeAllSolutionsOneBoardWithLookUp(PegBoard *myBoard, PegBoardSolver solver, int emptyPeg) {
+void timeAllSolutionsOneBoardWithLookUp(PegBoard *myBoard, PegBoardSolver &solver, int emptyPeg) {
     std::clock_t c_start, c_end;
     double duration;
 
@@ -62,6 +70,149 @@ void timeAllSolutionsOneBoardWithLookUp(PegBoard *myBoard, PegBoardSolver solver
     std::cout << emptyPeg << " Duration: " << duration << "\n";
 }
 
+/// <summary>
+/// timeEveryBoardWithLookUp() is a helper function that executes and times the solutions for every starting vacancy, one after another.
+/// The Look Up table is cleared before each starting vacancy.
+/// </summary>
+/// <param name="myBoard">Board to be Solved</param>
+/// <param name="solver">Solver to Employ</param>
+void timeEveryBoardWithLookUp(PegBoard *myBoard, PegBoardSolver &solver) {
+    std::clock_t c_start, c_end;
+    double duration;
+
+    solver.ShowSolutions = false;   // don't show solution to avoid impacting the timing statistic
+
+    c_start = std::clock();
+    for (int iEmpty = 0; iEmpty < NUMBER_OF_PEGS; iEmpty++) {
+        myBoard->Initialize(iEmpty);
+        std::cout << "Starting Vacancy: " << iEmpty << "\n";
+        solver.DFS_AllSolutionsWithLookUpUtil(myBoard);
+    }
+    c_end = std::clock();
+    duration = ((double)c_end - (double)c_start) / (double CLOCKS_PER_SEC);
+    std::cout << "Every Board Duration: " << duration << "\n";
+}
+
+/// <summary>
+/// timeEveryBoardWithSharedLookUp() is a helper function that executes and times the solutions for every starting vacancy in a single pass.
+/// The Look Up table is shared by all starting vacancies.
+/// </summary>
+/// <param name="myBoard">Board to be Solved</param>
+/// <param name="solver">Solver to Employ</param>
+void timeEveryBoardWithSharedLookUp(PegBoard *myBoard, PegBoardSolver &solver) {
+    std::clock_t c_start, c_end;
+    double duration;
+
+    solver.ShowSolutions = false;   // don't show solution to avoid impacting the timing statistic
+
+    c_start = std::clock();
+    solver.DFS_AllVacanciesWithLookUpUtil(myBoard);
+    c_end = std::clock();
+    duration = ((double)c_end - (double)c_start) / (double CLOCKS_PER_SEC);
+    std::cout << "Every Board Duration: " << duration << "\n";
+}
+
+/// <summary>
+/// timeAllSolutionsOneBoardSharded() is a helper function that executes and times the solution for a board with a specified starting vacancy.
+/// The search is split into shards that are solved by separate worker processes.
+/// </summary>
+/// <param name="myBoard">Board to be Solved</param>
+/// <param name="solver">Sharded Solver to Employ</param>
+/// <param name="emptyPeg">Starting Vacancy</param>
+void timeAllSolutionsOneBoardSharded(PegBoard myBoard, PegBoardShardedSolver &solver, int emptyPeg) {
+    std::chrono::steady_clock::time_point c_start, c_end;
+    double duration;
+
+    myBoard.Initialize(emptyPeg);
+
+    // std::clock() measures this process only, so use wall-clock time to include the workers
+    c_start = std::chrono::steady_clock::now();
+    solver.DFS_AllSolutionsShardedUtil(myBoard);
+    c_end = std::chrono::steady_clock::now();
+    duration = std::chrono::duration<double>(c_end - c_start).count();
+    std::cout << emptyPeg << " Duration: " << duration << "\n";
+}
+
+/// <summary>
+/// timeBatchLegality() is a helper function that compares the throughput of move generation on every board reachable in a specified number of moves.
+/// The list path calls PegBoard::GetAvailableMoves(), which also allocates the list of moves; the mask path tests the geometry's masks against each packed board
+/// without allocating, so it is the fair scalar baseline; the bit-sliced path evaluates BITSLICE_BOARDS boards per move at once.
+/// </summary>
+/// <param name="myBoard">Board used for the list path</param>
+/// <param name="emptyPeg">Starting Vacancy</param>
+/// <param name="depth">Number of moves played to build the layer of boards</param>
+/// <param name="repetitions">Number of times the layer is evaluated by each path</param>
+void timeBatchLegality(PegBoard myBoard, int emptyPeg, int depth, int repetitions) {
+    std::clock_t c_start, c_end;
+    double listDuration, maskDuration, slicedDuration;
+    std::set <typeBoardKey> layer, next;
+    long long listMoves = 0, maskMoves = 0, slicedMoves = 0;
+
+    // Build the layer (not timed)
+    myBoard.Initialize(emptyPeg);
+    layer.insert(myBoard.GetKey());
+    for (int d = 0; d < depth; d++) {
+        next.clear();
+        for (std::set <typeBoardKey>::iterator it = layer.begin(); it != layer.end(); it++) {
+            myBoard.SetKey(*it);
+            typeListOfMoves moves = myBoard.GetAvailableMoves();
+            for (typeListOfMoves::iterator m = moves.begin(); m != moves.end(); m++) {
+                myBoard.PerformMove(*m);
+                next.insert(myBoard.GetKey());
+                myBoard.TakeBackMove(*m);
+            }
+        }
+        layer.swap(next);
+    }
+    std::vector <typeBoardKey> keys(layer.begin(), layer.end());
+
+    c_start = std::clock();
+    for (int r = 0; r < repetitions; r++) {
+        for (size_t i = 0; i < keys.size(); i++) {
+            myBoard.SetKey(keys[i]);
+            listMoves += (long long)myBoard.GetAvailableMoves().size();
+        }
+    }
+    c_end = std::clock();
+    listDuration = ((double)c_end - (double)c_start) / (double CLOCKS_PER_SEC);
+
+    const Geometry *geometry = myBoard.GetGeometry();
+    const typeBoardKey *fromJump = geometry->GetFromJumpMasks();
+    const typeBoardKey *to = geometry->GetToMasks();
+    c_start = std::clock();
+    for (int r = 0; r < repetitions; r++) {
+        for (size_t i = 0; i < keys.size(); i++) {
+            for (int m = 0; m < geometry->GetNumberOfMoves(); m++) {
+                if ((keys[i] & fromJump[m]) == fromJump[m] && (keys[i] & to[m]) == 0)
+                    maskMoves++;
+            }
+        }
+    }
+    c_end = std::clock();
+    maskDuration = ((double)c_end - (double)c_start) / (double CLOCKS_PER_SEC);
+
+    BitSlicedBoards batch(geometry);
+    typeBoardMask legal;
+    c_start = std::clock();
+    for (int r = 0; r < repetitions; r++) {
+        for (size_t i = 0; i < keys.size(); i += BITSLICE_BOARDS) {
+            batch.Load(&keys[i], (int)(keys.size() - i));
+            for (int m = 0; m < batch.GetNumberOfMoves(); m++) {
+                batch.LegalMoves(m, legal);
+                for (int w = 0; w < BITSLICE_WORDS; w++)
+                    slicedMoves += std::popcount(legal[w]);
+            }
+        }
+    }
+    c_end = std::clock();
+    slicedDuration = ((double)c_end - (double)c_start) / (double CLOCKS_PER_SEC);
+
+    std::cout << emptyPeg << " Depth " << depth << ": " << keys.size() << " boards\n";
+    std::cout << "Scalar (List) Duration: " << listDuration << " (" << listMoves << " moves, " << (double)keys.size() * repetitions / listDuration << " boards/s)\n";
+    std::cout << "Scalar (Mask) Duration: " << maskDuration << " (" << maskMoves << " moves, " << (double)keys.size() * repetitions / maskDuration << " boards/s)\n";
+    std::cout << "Bit-Sliced Duration: " << slicedDuration << " (" << slicedMoves << " moves, " << (double)keys.size() * repetitions / slicedDuration << " boards/s)\n";
+}
+
 int main()
 {
     PegBoard myBoard; 
@@ -83,6 +234,13 @@ int main()
     }
     */
 
+    /* Solve a Single Board -- Lazily; only the first 5 solutions are searched for */
+    /*
+    myBoard.Initialize(4);
+    for (const PackedPath &solution : solver.Solutions(myBoard) | std::views::take(5))
+        myBoard.ShowPath(solution);
+    */
+
     /* Solve a Single Board -- No Look Up table; With timing statistic */
     /*
     timeAllSolutionsOneBoard(myBoard, solver, 4);
@@ -106,11 +264,88 @@ int main()
     solver.DFS_AllSolutionsWithLookUpUtil(myBoard);
     */
 
+    /* Solve a Single Board -- With Look Up table limited to 64 KB; With timing statistic */
+    /*
+    solver.SetLookUpBudget(64 * 1024, TwoTier);
+    timeAllSolutionsOneBoardWithLookUp(&myBoard, solver, 4);
+    */
+
     /* Solve a Single Board -- With Look Up table; With timing statistic */
     /*
     timeAllSolutionsOneBoardWithLookUp(&myBoard, solver, 4);
     */
   
+    /* Solve Every Board -- With Look Up table cleared for each board; With timing statistic */
+    /*
+    timeEveryBoardWithLookUp(&myBoard, solver);
+    */
+
+    /* Solve Every Board in a Single Pass -- With Look Up table shared by every board; With timing statistic */
+    /*
+    timeEveryBoardWithSharedLookUp(&myBoard, solver);
+    */
+
+    /* Solve a Single Board -- Sharded across worker processes; With timing statistic */
+    /*
+    PegBoardShardedSolver shardedSolver;
+    shardedSolver.NumberOfWorkers = 4;
+    timeAllSolutionsOneBoardSharded(myBoard, shardedSolver, 4);
+    */
+
+    /* Compare scalar and bit-sliced move generation on the boards 6 moves into a game -- With timing statistic */
+    /*
+    timeBatchLegality(myBoard, 4, 6, 1000);
+    */
+
+    /* Estimate a Single Board -- Monte Carlo playouts (Knuth's estimator); Playouts per second are displayed */
+    /*
+    PegBoardEstimator estimator;
+    estimator.NumberOfPlayouts = 10000000;
+    myBoard.Initialize(4);
+    estimator.EstimateUtil(myBoard);
+    */
+
+    /* Check the tables generated into GeneratedTables.h against tables built at runtime, then answer a query from them -- With timing statistic */
+    /*
+    Geometry::VerifyStandard();
+    myBoard.Initialize(4);
+    std::chrono::steady_clock::time_point c_start = std::chrono::steady_clock::now();
+    bool solvable = solver.IsSolvable(&myBoard);
+    std::cout << "Solvable: " << solvable << " (" << std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - c_start).count() << " microseconds)\n";
+    */
+
+    /* Solve an English (33-hole) Board -- Lazily, first solution only; the geometry must outlive the board (build with PEGBOARD_LARGE_GEOMETRY to show the path) */
+    /*
+    Geometry english = Geometry::English();
+    english.ShowGeometry();
+    myBoard.SetGeometry(&english);
+    myBoard.Initialize(16);
+    for (const PackedPath &solution : solver.Solutions(myBoard) | std::views::take(1))
+        myBoard.ShowPath(solution);
+    */
+
+    /* Estimate an English (33-hole) Board -- Monte Carlo playouts; exhaustive search is out of reach on this board */
+    /*
+    Geometry english = Geometry::English();
+    PegBoardEstimator estimator;
+    myBoard.SetGeometry(&english);
+    myBoard.Initialize(16);
+    estimator.EstimateUtil(myBoard);
+    */
+
+    /* Solve a Board read from a file -- With a Look Up table keyed by symmetry class; No timing statistic */
+    /*
+    Geometry hexagon;
+    if (hexagon.Load("Geometries/Hexagon19.txt")) {
+        hexagon.ShowGeometry();
+        myBoard.SetGeometry(&hexagon);
+        myBoard.Initialize(9);
+        solver.ShowSolutions = false;
+        solver.UseSymmetry = true;
+        solver.DFS_AllSolutionsWithLookUpUtil(&myBoard);
+    }
+    */
+
     /* Solve each Starting Position Class -- With Look Up table; With timing statistic */
     ///*
     for (int i = 0; i < 5; i++) {
@@ -0,0 +1,232 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// Generated by Tools/GenerateTables.cpp -- do not edit.  Included by Geometry.cpp only.
+#pragma once
+#include "Geometry.h"
+
+#define GENERATED_NAME "Triangle15"
+#define GENERATED_NUMBER_OF_HOLES 15
+#define GENERATED_NUMBER_OF_MOVES 36
+#define GENERATED_NUMBER_OF_SYMMETRIES 6
+#define GENERATED_SOLVABLE_WORDS 512
+
+// Moves as { from, to, jump }, sorted by (from, to)
+static const Move GeneratedMoves[GENERATED_NUMBER_OF_MOVES] = {
+	{ 0, 3, 1 }, { 0, 5, 2 }, { 1, 6, 3 }, { 1, 8, 4 }, { 2, 7, 4 }, { 2, 9, 5 },
+	{ 3, 0, 1 }, { 3, 5, 4 }, { 3, 10, 6 }, { 3, 12, 7 }, { 4, 11, 7 }, { 4, 13, 8 },
+	{ 5, 0, 2 }, { 5, 3, 4 }, { 5, 12, 8 }, { 5, 14, 9 }, { 6, 1, 3 }, { 6, 8, 7 },
+	{ 7, 2, 4 }, { 7, 9, 8 }, { 8, 1, 4 }, { 8, 6, 7 }, { 9, 2, 5 }, { 9, 7, 8 },
+	{ 10, 3, 6 }, { 10, 12, 11 }, { 11, 4, 7 }, { 11, 13, 12 }, { 12, 3, 7 }, { 12, 5, 8 },
+	{ 12, 10, 11 }, { 12, 14, 13 }, { 13, 4, 8 }, { 13, 11, 12 }, { 14, 5, 9 }, { 14, 12, 13 } };
+
+static const typeBoardKey GeneratedFromJumpMasks[GENERATED_NUMBER_OF_MOVES] = {
+	0x3, 0x5, 0xa, 0x12, 0x14, 0x24, 0xa, 0x18,
+	0x48, 0x88, 0x90, 0x110, 0x24, 0x30, 0x120, 0x220,
+	0x48, 0xc0, 0x90, 0x180, 0x110, 0x180, 0x220, 0x300,
+	0x440, 0xc00, 0x880, 0x1800, 0x1080, 0x1100, 0x1800, 0x3000,
+	0x2100, 0x3000, 0x4200, 0x6000 };
+
+static const typeBoardKey GeneratedToMasks[GENERATED_NUMBER_OF_MOVES] = {
+	0x8, 0x20, 0x40, 0x100, 0x80, 0x200, 0x1, 0x20,
+	0x400, 0x1000, 0x800, 0x2000, 0x1, 0x8, 0x1000, 0x4000,
+	0x2, 0x100, 0x4, 0x200, 0x2, 0x40, 0x4, 0x80,
+	0x8, 0x1000, 0x10, 0x2000, 0x8, 0x20, 0x400, 0x4000,
+	0x10, 0x800, 0x20, 0x1000 };
+
+static const typeBoardKey GeneratedMoveMasks[GENERATED_NUMBER_OF_MOVES] = {
+	0xb, 0x25, 0x4a, 0x112, 0x94, 0x224, 0xb, 0x38,
+	0x448, 0x1088, 0x890, 0x2110, 0x25, 0x38, 0x1120, 0x4220,
+	0x4a, 0x1c0, 0x94, 0x380, 0x112, 0x1c0, 0x224, 0x380,
+	0x448, 0x1c00, 0x890, 0x3800, 0x1088, 0x1120, 0x1c00, 0x7000,
+	0x2110, 0x3800, 0x4220, 0x7000 };
+
+// [from * GENERATED_NUMBER_OF_HOLES + to] is the move from <from> to <to>, or -1
+static const short GeneratedMoveIndex[GENERATED_NUMBER_OF_HOLES * GENERATED_NUMBER_OF_HOLES] = {
+	-1, -1, -1, 0, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 2, -1, 3, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 4, -1, 5, -1, -1, -1, -1, -1,
+	6, -1, -1, -1, -1, 7, -1, -1, -1, -1, 8, -1, 9, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, -1, 11, -1,
+	12, -1, -1, 13, -1, -1, -1, -1, -1, -1, -1, -1, 14, -1, 15,
+	-1, 16, -1, -1, -1, -1, -1, -1, 17, -1, -1, -1, -1, -1, -1,
+	-1, -1, 18, -1, -1, -1, -1, -1, -1, 19, -1, -1, -1, -1, -1,
+	-1, 20, -1, -1, -1, -1, 21, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 22, -1, -1, -1, -1, 23, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 24, -1, -1, -1, -1, -1, -1, -1, -1, 25, -1, -1,
+	-1, -1, -1, -1, 26, -1, -1, -1, -1, -1, -1, -1, -1, 27, -1,
+	-1, -1, -1, 28, -1, 29, -1, -1, -1, -1, 30, -1, -1, -1, 31,
+	-1, -1, -1, -1, 32, -1, -1, -1, -1, -1, -1, 33, -1, -1, -1,
+	-1, -1, -1, -1, -1, 34, -1, -1, -1, -1, -1, -1, 35, -1, -1 };
+
+// Moves in which hole h is the from, jump or to hole: GeneratedMovesOfHole[GeneratedMovesOfHoleStart[h]] up to GeneratedMovesOfHoleStart[h + 1]
+static const int GeneratedMovesOfHoleStart[GENERATED_NUMBER_OF_HOLES + 1] = { 0, 4, 10, 16, 26, 36, 46, 52, 62, 72, 78, 82, 88, 98, 104, 108 };
+static const int GeneratedMovesOfHole[108] = {
+	0, 1, 6, 12,
+	0, 2, 3, 6, 16, 20,
+	1, 4, 5, 12, 18, 22,
+	0, 2, 6, 7, 8, 9, 13, 16, 24, 28,
+	3, 4, 7, 10, 11, 13, 18, 20, 26, 32,
+	1, 5, 7, 12, 13, 14, 15, 22, 29, 34,
+	2, 8, 16, 17, 21, 24,
+	4, 9, 10, 17, 18, 19, 21, 23, 26, 28,
+	3, 11, 14, 17, 19, 20, 21, 23, 29, 32,
+	5, 15, 19, 22, 23, 34,
+	8, 24, 25, 30,
+	10, 25, 26, 27, 30, 33,
+	9, 14, 25, 27, 28, 29, 30, 31, 33, 35,
+	11, 27, 31, 32, 33, 35,
+	15, 31, 34, 35 };
+
+// Hole i is mapped to hole GeneratedSymmetries[s][i] by symmetry s
+static const unsigned char GeneratedSymmetries[GENERATED_NUMBER_OF_SYMMETRIES][GENERATED_NUMBER_OF_HOLES] = {
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14 },
+	{ 0, 2, 1, 5, 4, 3, 9, 8, 7, 6, 14, 13, 12, 11, 10 },
+	{ 10, 6, 11, 3, 7, 12, 1, 4, 8, 13, 0, 2, 5, 9, 14 },
+	{ 10, 11, 6, 12, 7, 3, 13, 8, 4, 1, 14, 9, 5, 2, 0 },
+	{ 14, 9, 13, 5, 8, 12, 2, 4, 7, 11, 0, 1, 3, 6, 10 },
+	{ 14, 13, 9, 12, 8, 5, 11, 7, 4, 2, 10, 6, 3, 1, 0 } };
+
+// Bit k % 64 of word k / 64 is set when board k can be reduced to a single peg
+static const unsigned long long GeneratedSolvable[GENERATED_SOLVABLE_WORDS] = {
+	0x7cc50051d1bd453eULL, 0xb5db10c0e3380309ULL, 0xc8bd44405ca78509ULL, 0xe77e5091bd9b4221ULL,
+	0xe0745091bd9b4021ULL, 0xd1b820107e820000ULL, 0xbddb7cc7e73ed3a9ULL, 0x7ee7b5dbdbbde728ULL,
+	0x9dcb0403e72cc021ULL, 0x7ee70000dbbc0000ULL, 0xc57e0800ac820400ULL, 0xdbbd44427ea78509ULL,
+	0xdbbd44427ea78509ULL, 0xe77e5091bd9b4221ULL, 0x7ee79ddbdbbde728ULL, 0xbddb7ee7e73edba8ULL,
+	0xc004000044800401ULL, 0x417c000020d10045ULL, 0x4004000040850400ULL, 0x85d84044e55c0085ULL,
+	0x80504000c5580000ULL, 0x50e0005052bd0040ULL, 0xc57cc004add94cc5ULL, 0xd3bdc17c7ee735dbULL,
+	0x440800008c000000ULL, 0x029d000444e700c0ULL, 0x0408000084000000ULL, 0x4ec50008c8ad0404ULL,
+	0x4cc50000c8a50400ULL, 0xb5db4044e57e0085ULL, 0xca9d440c4ce78cc0ULL, 0xe77ec39dbddb7ce7ULL,
+	0xc454000090d00001ULL, 0xd1bd004074a00108ULL, 0xbcd17cc5c56cd1bdULL, 0x7ce7b5dbdbb8e738ULL,
+	0x74c414d1d9b8c020ULL, 0xbdd970c5e72a51a8ULL, 0xdbbde57c7ce7bd9bULL, 0xe77edbbdbdda7ea2ULL,
+	0xd9bd000074e40000ULL, 0xe77e0000bdd80000ULL, 0x5ce79dcbcbace72cULL, 0xbddb7ee7e77cdbbdULL,
+	0xbddb7ce7e77cd1bdULL, 0x7ee7b5dbdbb8e738ULL, 0xe77edbbdbddb7ea7ULL, 0xdbbde77e7ee7bd9bULL,
+	0x00c00000c0540001ULL, 0x70c4000051b80000ULL, 0xc47cc0048cd14cc5ULL, 0xdbbdc17c7ce735dbULL,
+	0xd0b0c0707cc50051ULL, 0xe07450b4b5db10c0ULL, 0x7ce78558dbbde558ULL, 0xbddb7ee5e77ed3bdULL,
+	0x4cc50000c0ac0000ULL, 0x35db0000e77c0000ULL, 0xc89d440c4ce78cc0ULL, 0xe77ec39dbddb7ce7ULL,
+	0xe77cc015bddb4ce7ULL, 0xdbbdc17c7ee735dbULL, 0xbddb4ec5e77ec8a5ULL, 0x7ee7bddbdbbde77eULL,
+	0x00c00000c0540001ULL, 0x70c0000051b80000ULL, 0xc47cc0008cd14c45ULL, 0xd3bdc0707ce715dbULL,
+	0xd0b0c0707cc50051ULL, 0xe07050b0b5db10c0ULL, 0x7ce78050dbbd4440ULL, 0xb5db50a0e77e5091ULL,
+	0x4c450000c0ac0000ULL, 0x15db0000e77c0000ULL, 0xc89d44044ce78cc0ULL, 0xe77ec11dbddb7ce7ULL,
+	0xc77cc015bddb4ce7ULL, 0xdbbdc17c7ee735dbULL, 0x9ddb4444e77e8885ULL, 0x7ee715d9dbbde56aULL,
+	0x0000000000400000ULL, 0x4000000010c00000ULL, 0x04c0000084440004ULL, 0x70c500c0d1ad014cULL,
+	0x40c00040c0050000ULL, 0x30d010c0c17c0000ULL, 0xd08500405ce50000ULL, 0xe17c1080b5db4044ULL,
+	0x0004000000800000ULL, 0x014c000024c00000ULL, 0x08440000008c0000ULL, 0x1dca0044e74c008cULL,
+	0x0cc00000c44c0004ULL, 0x7cc700c0d3bd014cULL, 0xc54e0000adc80004ULL, 0xdbbd04447ee78188ULL,
+	0xd084000054c40401ULL, 0xe57c0000bdd90045ULL, 0x5ce514c0d0bdc55cULL, 0xbddb7cc5e77cdbbdULL,
+	0xbcd17cc5c57cd1bdULL, 0x74e3b5dbdbbde378ULL, 0xe77cd9bdbddb7ce7ULL, 0xdbbde77e7ee7bddbULL,
+	0xc55c0001bdc84020ULL, 0xdbbd00047ee700c0ULL, 0xbddb4c45e57ed1acULL, 0x7ee79ddbdbbde77cULL,
+	0x7ce79ddbdbbde77cULL, 0xbddb7ee7e77edbbdULL, 0xdbbde77e7ee7bddbULL, 0xe77edbbdbddb7ee7ULL,
+	0x4004000050800000ULL, 0x85d80000e0540004ULL, 0xc895444054e58548ULL, 0xe57ed095bdd956e5ULL,
+	0xe054d08595d844a0ULL, 0xd1bc617c7ec520d1ULL, 0xbdd97cc5e57ed1adULL, 0x7ee7b5dbdbbde77cULL,
+	0x85480000e4000000ULL, 0x5ee50000d8bd0040ULL, 0xc54e0804acd14480ULL, 0xdbbd454e7ee7add9ULL,
+	0xd9bd444a7ee58d48ULL, 0xe77ed29dbddb56e7ULL, 0x7ee79dcadbbde74cULL, 0xbddb7ee7e77edbbdULL,
+	0xd084000054c40001ULL, 0xe55c0000bdd80000ULL, 0x5ce514c0d0acc508ULL, 0xbddb7cc5e77cdbbdULL,
+	0xbcd17cc5c578d1bdULL, 0x74e3b5dbdbb8e338ULL, 0xe77cd9bdbddb7ca7ULL, 0xdbbde77e7ee7bd9bULL,
+	0xc55c0001bd884020ULL, 0xdbbd00007ee40000ULL, 0xbddb4c45e52ad1a8ULL, 0x7ee79ddbdbace72cULL,
+	0x7ce79ddbdbace72cULL, 0xbddb7ee7e77cdbbdULL, 0xdbbde77e7ee6bd8aULL, 0xe77edbbdbddb7ea7ULL,
+	0x4004000050800000ULL, 0x85d80000e0540000ULL, 0xc895444054a58508ULL, 0xe55ed095bdd846e5ULL,
+	0xe054d08595d844a0ULL, 0xd1bc617c7ec520d1ULL, 0xbdd97cc5e57ed1adULL, 0x7ee7b5dbdbbde77cULL,
+	0x85480000e4000000ULL, 0x5ee50000d8bd0040ULL, 0xc54e0804acd14480ULL, 0xdbbd454e7ee5add9ULL,
+	0xd9bd444a7ea58d08ULL, 0xe77ed29dbddb46e7ULL, 0x7ee79dcadbbde748ULL, 0xbddb7ee7e77edbbdULL,
+	0x14c00000c0400000ULL, 0x74c510c0d0a00108ULL, 0xc474d08484c054c4ULL, 0xd9bde55c7ce0bdd8ULL,
+	0xd090c4545cc090d0ULL, 0xe474d1bdbd8a74a0ULL, 0x7ce5bdd9d9bde57cULL, 0xbddb7ee7e77adbb8ULL,
+	0x5cc40401d188c020ULL, 0xbddb0045e76851a8ULL, 0xd8bdc55c5ca2bd88ULL, 0xe77edbbdbdca7ee4ULL,
+	0xe57cd9bdbdc874e4ULL, 0xdbbde77e7ee2bdd8ULL, 0xbddb7ee7e76edbacULL, 0x7ee7bddbdbbde77cULL,
+	0xc454001090d00001ULL, 0xd1bd004074e00108ULL, 0xbcd17cc5c57cd1bdULL, 0x7ce7b5dbdbbde77cULL,
+	0x74c414d1d9bdc074ULL, 0xbdd970c5e77e51b8ULL, 0xdbbde57c7ce7bddbULL, 0xe77edbbdbddb7ee7ULL,
+	0xd9bd00007ce50051ULL, 0xe77e0004bddb10c0ULL, 0x5ce79dcbcbbde76cULL, 0xbddb7ee7e77edbbdULL,
+	0xbddb7ce7e77cd1bdULL, 0x7ee7b5dbdbbde77cULL, 0xe77edbbdbddb7ee7ULL, 0xdbbde77e7ee7bddbULL,
+	0xc454001090d00001ULL, 0xd1bd004074e00108ULL, 0xbcd17cc5c57cd1bdULL, 0x7ce7b5dbdbbde77cULL,
+	0x74c414d1d9bdc074ULL, 0xbdd970c5e77e51b8ULL, 0xdbbde57c7ce7bddbULL, 0xe77edbbdbddb7ee7ULL,
+	0xd9bd00007ce50051ULL, 0xe77e0000bddb10c0ULL, 0x5ce79dcbcbbde76cULL, 0xbddb7ee7e77edbbdULL,
+	0xbddb7ce7e77cd1bdULL, 0x7ee7b5dbdbbde77cULL, 0xe77edbbdbddb7ee7ULL, 0xdbbde77e7ee7bddbULL,
+	0x00c00000c0540001ULL, 0x70c4000051b80000ULL, 0xc47cc0048cd14cc5ULL, 0xdbbdc17c7ce735dbULL,
+	0xd0b0c0707cc50051ULL, 0xe07450b4b5db10c0ULL, 0x7ce785d8dbbde55cULL, 0xbddb7ee5e77ed3bdULL,
+	0x4cc50000c0ac0000ULL, 0x35db0000e77c0000ULL, 0xc89d440c4ce78cc0ULL, 0xe77ec39dbddb7ce7ULL,
+	0xe77cc015bddb4ce7ULL, 0xdbbdc17c7ee735dbULL, 0xbddb4ec5e77ec8adULL, 0x7ee7bddbdbbde77eULL,
+	0x4044000050800000ULL, 0x95d80000e4540000ULL, 0xd895c45454e595d8ULL, 0xe57ed1bdbdd976e5ULL,
+	0xe454d09595d954e4ULL, 0xd1bde57c7ee5bdd9ULL, 0xbdd97ce5e57ed9bdULL, 0x7ee7bddbdbbde77eULL,
+	0x95d80000e4540000ULL, 0x7ee50000d9bd0040ULL, 0xc57ed9bdbdd97ce5ULL, 0xdbbde77e7ee7bddbULL,
+	0xd9bdc55e7ee5bdd9ULL, 0xe77edbbdbddb7ee7ULL, 0x7ee7bddbdbbde77eULL, 0xbddb7ee7e77edbbdULL,
+	0x0000000040400000ULL, 0x4440000090d00000ULL, 0x54c400c0c095c454ULL, 0xb5d970c4e57c51bdULL,
+	0x90d04044c4545090ULL, 0x70e495d8d9bde054ULL, 0xe47cd8b5bdd97ce5ULL, 0xdbbde57e7ee7bddbULL,
+	0xc454000080c00000ULL, 0xd9bd000074e40000ULL, 0x8cd94cc5c57cc0acULL, 0x7ee7b5dbdbbde77cULL,
+	0x7ce585c9d9bde474ULL, 0xbddb7ee5e77ed9bdULL, 0xdbbde77e7ee7bddbULL, 0xe77edbbdbddb7ee7ULL,
+	0xc050001010800001ULL, 0x50b0000020000000ULL, 0x80d1400044640000ULL, 0x70e00010d1990000ULL,
+	0x4040001010910000ULL, 0x1090000020000000ULL, 0xd1b9c0707ce510d1ULL, 0xe27050b0b5db30c0ULL,
+	0x410800007cc50051ULL, 0x02500000b5db10c0ULL, 0x44460000c8bd4440ULL, 0x9dd94000e77e5091ULL,
+	0x91d94000e4745091ULL, 0x72e00010d1b92010ULL, 0xc77ec11dbddb7ce7ULL, 0xdbbdc37c7ee7b5dbULL,
+	0x0040000040000000ULL, 0x10c0000000100000ULL, 0x0040000000000000ULL, 0x5080004040440000ULL,
+	0x0000000040000000ULL, 0x0040000000100000ULL, 0x54c00040c0144000ULL, 0x30d110c0c17c0010ULL,
+	0x04000000c0040000ULL, 0x00410000417c0000ULL, 0x0000000040040000ULL, 0x4444000085d84044ULL,
+	0x4440000080504000ULL, 0x5091004050e40050ULL, 0x0cc10400c57cc004ULL, 0x7cc700c1d3bdc17cULL,
+	0x4044000010800000ULL, 0x91d8000060000000ULL, 0xc895c45054e49188ULL, 0xe57e50b1bd996220ULL,
+	0xe054509195994020ULL, 0xd1b8205072c51080ULL, 0xbdd97cc5e57ed1b9ULL, 0x7ee7b5dbdbbde260ULL,
+	0x91c80000e4540000ULL, 0x76e40000d9bd0040ULL, 0xc57e4908bcd17cc5ULL, 0xdbbdc6527ee7b5dbULL,
+	0xd9bdc45276e495d9ULL, 0xe77e51b9bdd972e5ULL, 0x7ee79ddbdbbde77cULL, 0xbddb7ee7e77edbbdULL,
+	0x0000000040400000ULL, 0x0040000010900000ULL, 0x40c40040c0914400ULL, 0xb5d850c4e4740091ULL,
+	0x90d04000c4500010ULL, 0x70e0005050b50040ULL, 0xc474d08495d94480ULL, 0xd1bde17c7ee530d1ULL,
+	0x4404000080c00000ULL, 0x4199000070e40000ULL, 0x0cc90400c47cc004ULL, 0x7ec70049dbbdc57cULL,
+	0x4cc50041d9b9c470ULL, 0xb5db50c4e67650b5ULL, 0xd99d44487ce78d58ULL, 0xe77ed39dbddb7ee7ULL,
+	0x0000000000400000ULL, 0x0000000010800000ULL, 0x40c00000c0114000ULL, 0x30d00000c0700010ULL,
+	0x10900000c0500010ULL, 0x2000000050b00000ULL, 0xc474000091d94000ULL, 0xd1b9000072e00010ULL,
+	0x4004000000c00000ULL, 0x0118000070c00000ULL, 0x0cc10400c47cc000ULL, 0x7cc70001d3bdc070ULL,
+	0x4cc50001d1b9c070ULL, 0x35db0000e27050b0ULL, 0xc99d04407ce78050ULL, 0xe77e1081bddb50a0ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000000000400000ULL, 0x4050000010c00040ULL,
+	0x4000000000400000ULL, 0x0010000010c00000ULL, 0x0050000044400000ULL, 0x50c4000050910040ULL,
+	0x0000000000000000ULL, 0x0040000040000000ULL, 0x0004000004c00000ULL, 0x410c000474c500c0ULL,
+	0x4004000044c00040ULL, 0x415c000030d110c0ULL, 0x44440000d0850040ULL, 0x15d90004e57c1080ULL,
+	0x00c00000c0540001ULL, 0x70c00000d1b80000ULL, 0xc47cc0008cd14c45ULL, 0xdbbdc0707ce715dbULL,
+	0xd0b0c0707cc510d1ULL, 0xe07050b0b5db30c0ULL, 0x7ce791d9dbbde474ULL, 0xbddb72e0e77ed1b9ULL,
+	0x4c450000d0ac0000ULL, 0x1ddb0000e77c0000ULL, 0xc89d44045ce79cc0ULL, 0xe77ec11dbddb7ce7ULL,
+	0xe77cc11dbddb7ce7ULL, 0xdbbdc37c7ee7b5dbULL, 0xbddb7ec7e77ed9bdULL, 0x7ee7bddbdbbde77eULL,
+	0x0040000000400000ULL, 0x5080000010c00000ULL, 0x84d04000c4440004ULL, 0x70e500d0d1bd414cULL,
+	0x40c00050d0854000ULL, 0x30d010c0e17c0010ULL, 0xd095c4505ce590c0ULL, 0xe57c50b1b5db70e4ULL,
+	0x0004000040840000ULL, 0x414c0000a5d80000ULL, 0x4c440000c89d4440ULL, 0x9ddb4444e77ed09dULL,
+	0x9dd84400e45cd085ULL, 0x7ee700d1d3bd617cULL, 0xc57ec90cbdd97cc5ULL, 0xdbbdc77e7ee7b5dbULL,
+	0x00c00000c0540001ULL, 0x70c00000d1b80000ULL, 0xc47cc0008cd14c45ULL, 0xdbbdc0707ce715dbULL,
+	0xd0b0c0707cc510d1ULL, 0xe07050b0b5db30c0ULL, 0x7ce791d9dbbd6464ULL, 0xbddb72e0e77ed199ULL,
+	0x4c450000d0ac0000ULL, 0x1ddb0000e77c0000ULL, 0xc89d44045ce79cc0ULL, 0xe77ec11dbddb7ce7ULL,
+	0xe77cc11dbddb7ce7ULL, 0xdbbdc37c7ee7b5dbULL, 0xbddb7ec7e77ed9bdULL, 0x7ee7bddbdbbde77eULL,
+	0x0040000000400000ULL, 0x5080000010c00000ULL, 0x84d04000c4440004ULL, 0x70e500d0d1ad414cULL,
+	0x40c00050d0854000ULL, 0x30d010c0e17c0010ULL, 0xd095c4505ce59080ULL, 0xe57c50b1b5db6064ULL,
+	0x0004000040840000ULL, 0x414c0000a5d80000ULL, 0x4c440000c89d4440ULL, 0x9dda4444e75ed09dULL,
+	0x9dd84400e45cd085ULL, 0x7ee700d1d3bd617cULL, 0xc57ec90cbdd97cc5ULL, 0xdbbdc77e7ee7b5dbULL,
+	0xd084000054c40401ULL, 0xe57c0000bdd90045ULL, 0x5ce514c0d0bdc55cULL, 0xbddb7cc5e77cdbbdULL,
+	0xbcd17cc5c57cd1bdULL, 0x74e3b5dbdbbde378ULL, 0xe77cd9bdbddb7ce7ULL, 0xdbbde77e7ee7bddbULL,
+	0xc55c0001bdc84020ULL, 0xdbbd00047ee710c0ULL, 0xbddb4c45e57ed1acULL, 0x7ee79ddbdbbde77cULL,
+	0x7ce79ddbdbbde77cULL, 0xbddb7ee7e77edbbdULL, 0xdbbde77e7ee7bddbULL, 0xe77edbbdbddb7ee7ULL,
+	0x4044000050800000ULL, 0x95d80000e0540004ULL, 0xc895c45054e595c8ULL, 0xe57ed0b5bdd976e5ULL,
+	0xe054d09595d944e0ULL, 0xd1bc617c7ec530d1ULL, 0xbdd97cc5e57ed1bdULL, 0x7ee7b5dbdbbde77cULL,
+	0x95c80000e4540010ULL, 0x7ee50000d9bd0040ULL, 0xc57e490cbcd17cc5ULL, 0xdbbdc75e7ee7bddbULL,
+	0xd9bdc45e7ee59dd9ULL, 0xe77ed3bdbddb76e7ULL, 0x7ee79ddbdbbde77cULL, 0xbddb7ee7e77edbbdULL,
+	0x4044000010800000ULL, 0x91d8000060000000ULL, 0xc895c45054e49188ULL, 0xe57e50b1bdd96260ULL,
+	0xe054509195d94060ULL, 0xd1b8205072c51080ULL, 0xbdd97cc5e57ed1b9ULL, 0x7ee7b5dbdbbde270ULL,
+	0x91c80000e4540010ULL, 0x76e40000d9bd0040ULL, 0xc57e4908bcd17cc5ULL, 0xdbbdc6567ee7b5dbULL,
+	0xd9bdc4567ee595d9ULL, 0xe77e51b9bddb72e5ULL, 0x7ee79ddbdbbde77cULL, 0xbddb7ee7e77edbbdULL,
+	0x0000000040400000ULL, 0x0040000010900000ULL, 0x40c40040c0914400ULL, 0xb5d850c4e4740091ULL,
+	0x90d04000c4500010ULL, 0x70e0005050b50040ULL, 0xc474d08495d944c0ULL, 0xd1bde17c7ee530d1ULL,
+	0x4404000080c00000ULL, 0x4199000070e40000ULL, 0x0cc90400c47cc004ULL, 0x7ec70049dbbdc57cULL,
+	0x4cc50041d9bdc470ULL, 0xb5db50c4e77e50b5ULL, 0xd99d444c7ce78dd8ULL, 0xe77ed39dbddb7ee7ULL,
+	0x0040000000400000ULL, 0xd080000054c00000ULL, 0x84d04044c4545084ULL, 0x7ce591d8d9bde15cULL,
+	0x54c000d0d095c054ULL, 0xb0d170c0e57cd1b8ULL, 0xd8bde47c7ce59dd9ULL, 0xe77edbbdbddb7ee7ULL,
+	0x5084000040c40000ULL, 0xe55c0000bdd80000ULL, 0x4ce595c8d8bde454ULL, 0xbddb7ee5e77ed9bdULL,
+	0x9dd94c45e57cd0bdULL, 0x7ee79ddbdbbde77cULL, 0xe77ed9bdbddb7ee7ULL, 0xdbbde77e7ee7bddbULL,
+	0x0000000000000000ULL, 0x4000000040000000ULL, 0x4440000080504040ULL, 0xd095004054e410d0ULL,
+	0x5080004040440040ULL, 0xe054508095d810c0ULL, 0x54e494d0d895c454ULL, 0xb5d970e5e57ed1bdULL,
+	0x4040000000000000ULL, 0x14d00000c4400000ULL, 0xc895440454e480c0ULL, 0xe57e419dbdd970e4ULL,
+	0xc454000495d840c4ULL, 0xd9bd414c7ee5b5d8ULL, 0x9dd94cc5e57ed9bdULL, 0x7ee7bddbdbbde77eULL };
@@ -0,0 +1,110 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+
+// Generator<T> is a lazy sequence produced by a coroutine that co_yields values of type T (requires C++20).
+// The coroutine runs only when the caller asks for the next value and is suspended in between, so the caller can
+// take the first k values, filter them (e.g. with std::views::take / std::views::filter), or simply stop iterating.
+// Destroying the Generator destroys the suspended coroutine and everything it holds.
+template <class T>
+class Generator : public std::ranges::view_base
+{
+public:
+	struct promise_type {
+		const T *current = nullptr;	// value of the last co_yield; it lives in the suspended coroutine
+		std::exception_ptr exception;
+
+		Generator get_return_object() {
+			return Generator(std::coroutine_handle <promise_type>::from_promise(*this));
+		}
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		std::suspend_always yield_value(const T &value) noexcept {
+			current = std::addressof(value);
+			return {};
+		}
+		void return_void() noexcept {}
+		void unhandled_exception() { exception = std::current_exception(); }
+	};
+
+	class iterator
+	{
+	private:
+		std::coroutine_handle <promise_type> coroutine;
+
+	public:
+		typedef std::input_iterator_tag iterator_category;
+		typedef std::ptrdiff_t difference_type;
+		typedef T value_type;
+
+		iterator(void) noexcept : coroutine(nullptr) {}
+		explicit iterator(std::coroutine_handle <promise_type> h) noexcept : coroutine(h) {}
+
+		const T &operator*() const { return *coroutine.promise().current; }
+		const T *operator->() const { return coroutine.promise().current; }
+		iterator &operator++() {
+			coroutine.resume();
+			if (coroutine.done() && coroutine.promise().exception)
+				std::rethrow_exception(coroutine.promise().exception);
+			return *this;
+		}
+		void operator++(int) { ++*this; }
+		friend bool operator==(const iterator &it, std::default_sentinel_t) noexcept {
+			return !it.coroutine || it.coroutine.done();
+		}
+	};
+
+	Generator(void) noexcept : coroutine(nullptr) {}
+	Generator(const Generator &) = delete;
+	Generator(Generator &&src) noexcept : coroutine(src.coroutine) { src.coroutine = nullptr; }
+	Generator &operator=(const Generator &) = delete;
+	Generator &operator=(Generator &&src) noexcept {
+		if (this != &src) {
+			if (coroutine)
+				coroutine.destroy();
+			coroutine = src.coroutine;
+			src.coroutine = nullptr;
+		}
+		return *this;
+	}
+	~Generator(void) {
+		if (coroutine)
+			coroutine.destroy();
+	}
+
+	// begin() runs the coroutine up to its first co_yield; it may only be called once
+	iterator begin() {
+		if (coroutine) {
+			coroutine.resume();
+			if (coroutine.done() && coroutine.promise().exception)
+				std::rethrow_exception(coroutine.promise().exception);
+		}
+		return iterator(coroutine);
+	}
+	std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+private:
+	std::coroutine_handle <promise_type> coroutine;
+
+	explicit Generator(std::coroutine_handle <promise_type> h) noexcept : coroutine(h) {}
+};
@@ -0,0 +1,678 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include "Geometry.h"
+#include "PackedPath.h"
+#ifndef PEGBOARD_NO_GENERATED_TABLES
+#include "GeneratedTables.h"
+#endif
+
+//
+// Private Methods
+//
+
+/// <summary>
+/// Geometry::AddMove() appends a move to the move list.  Derive() must be called once every move has been added.
+/// </summary>
+/// <param name="from">Hole of the peg that moves</param>
+/// <param name="jump">Hole of the peg that is jumped (removed)</param>
+/// <param name="to">Hole where the peg lands</param>
+/// <returns>Returns false if a hole is out of range or the three holes are not distinct</returns>
+bool Geometry::AddMove(int from, int jump, int to) {
+	if (from < 0 || from >= NumberOfHoles || jump < 0 || jump >= NumberOfHoles || to < 0 || to >= NumberOfHoles)
+		return false;
+	if (from == jump || from == to || jump == to)
+		return false;
+	Move m = { from, to, jump };
+	moves.push_back(m);
+	return true;
+}
+
+/// <summary>
+/// Geometry::Derive() sorts the moves by (from, to) and builds every table derived from them: masks, reverse index, moves of each hole and symmetries.
+/// </summary>
+/// <param name="error">Receives the reason if the geometry is not valid</param>
+/// <returns>Returns true if the geometry is valid</returns>
+bool Geometry::Derive(std::string &error) {
+	if (NumberOfHoles < 1 || NumberOfHoles > MAX_NUMBER_OF_PEGS) {
+		error = "a board has between 1 and " + std::to_string(MAX_NUMBER_OF_PEGS) + " holes";
+		return false;
+	}
+	if ((int)moves.size() > MAX_NUMBER_OF_MOVES) {
+		error = "a board has at most " + std::to_string(MAX_NUMBER_OF_MOVES) + " moves";
+		return false;
+	}
+
+	std::sort(moves.begin(), moves.end(), [](const Move &a, const Move &b) {
+		return (a.from < b.from) || ((a.from == b.from) && (a.to < b.to));
+	});
+
+	int n = (int)moves.size();
+	fromJumpMask.assign(n, 0);
+	toMask.assign(n, 0);
+	moveMask.assign(n, 0);
+	moveIndex.assign(NumberOfHoles * NumberOfHoles, -1);
+	movesOfHole.assign(NumberOfHoles, std::vector <int>());
+	for (int i = 0; i < n; i++) {
+		const Move &m = moves[i];
+		if (moveIndex[m.from * NumberOfHoles + m.to] >= 0) {
+			error = "the move " + std::to_string(m.from) + " -> " + std::to_string(m.to) + " is given twice";
+			return false;
+		}
+		moveIndex[m.from * NumberOfHoles + m.to] = (short)i;
+		fromJumpMask[i] = ((typeBoardKey)1 << m.from) | ((typeBoardKey)1 << m.jump);
+		toMask[i] = ((typeBoardKey)1 << m.to);
+		moveMask[i] = fromJumpMask[i] | toMask[i];
+		movesOfHole[m.from].push_back(i);
+		movesOfHole[m.jump].push_back(i);
+		movesOfHole[m.to].push_back(i);
+	}
+
+	FindSymmetries();
+	fitsPackedPath = (GetMoveBits() <= PACKED_MOVE_BITS) && (NumberOfHoles - 2 <= PACKED_PATH_CAPACITY);
+	return true;
+}
+
+/// <summary>
+/// Geometry::FindSymmetries() finds the permutations of the holes that map every move onto a move.
+/// Holes are assigned in breadth-first order so that each new hole completes moves with holes already assigned, which prunes the search early.
+/// </summary>
+/// <param name=""></param>
+void Geometry::FindSymmetries(void) {
+	std::vector <int> order;
+	std::vector <bool> visited(NumberOfHoles, false);
+	for (int start = 0; start < NumberOfHoles; start++) {
+		if (visited[start])
+			continue;
+		visited[start] = true;
+		order.push_back(start);
+		for (size_t k = order.size() - 1; k < order.size(); k++) {
+			for (int i : movesOfHole[order[k]]) {
+				int holes[3] = { moves[i].from, moves[i].jump, moves[i].to };
+				for (int h : holes) {
+					if (!visited[h]) {
+						visited[h] = true;
+						order.push_back(h);
+					}
+				}
+			}
+		}
+	}
+
+	int image[MAX_NUMBER_OF_PEGS];
+	bool used[MAX_NUMBER_OF_PEGS];
+	for (int i = 0; i < NumberOfHoles; i++) {
+		image[i] = -1;
+		used[i] = false;
+	}
+	symmetries.clear();
+	ExtendSymmetry(order, 0, image, used);
+}
+
+/// <summary>
+/// Geometry::ExtendSymmetry() assigns an image to hole order[depth] in every way that is consistent with the holes already assigned, and recurses.
+/// </summary>
+/// <param name="order">Order in which holes are assigned</param>
+/// <param name="depth">Number of holes already assigned</param>
+/// <param name="image">Partial permutation; -1 for holes not yet assigned</param>
+/// <param name="used">Holes already used as an image</param>
+void Geometry::ExtendSymmetry(const std::vector <int> &order, int depth, int *image, bool *used) {
+	if ((int)symmetries.size() >= MAX_NUMBER_OF_SYMMETRIES)
+		return;
+	if (depth == NumberOfHoles) {
+		Symmetry s;
+		for (int i = 0; i < NumberOfHoles; i++)
+			s.image[i] = (unsigned char)image[i];
+		symmetries.push_back(s);
+		return;
+	}
+
+	int h = order[depth];
+	for (int c = 0; c < NumberOfHoles; c++) {
+		if (used[c] || movesOfHole[c].size() != movesOfHole[h].size())
+			continue;
+
+		image[h] = c;
+		bool consistent = true;
+		for (size_t k = 0; k < movesOfHole[h].size() && consistent; k++) {
+			const Move &m = moves[movesOfHole[h][k]];
+			if (image[m.from] < 0 || image[m.jump] < 0 || image[m.to] < 0)
+				continue;
+			int i = GetMoveIndex(image[m.from], image[m.to]);
+			consistent = (i >= 0) && (moves[i].jump == image[m.jump]);
+		}
+		if (consistent) {
+			used[c] = true;
+			ExtendSymmetry(order, depth + 1, image, used);
+			used[c] = false;
+		}
+		image[h] = -1;
+	}
+}
+
+/// <summary>
+/// Geometry::FromGrid() builds a board drawn on a square grid: 'o' is a hole, anything else is not.  Holes are numbered row by row.
+/// Moves jump two holes along a row or a column.
+/// </summary>
+/// <param name="name">Name of the geometry</param>
+/// <param name="rows">Rows of the grid, all of the same length</param>
+/// <param name="numberOfRows">Number of rows</param>
+/// <returns>The geometry, or an empty geometry if it is not valid</returns>
+Geometry Geometry::FromGrid(const char *name, const char **rows, int numberOfRows) {
+	Geometry g;
+	int width = (int)strlen(rows[0]);
+	std::vector <int> hole(numberOfRows * width, -1);
+	g.Name = name;
+	for (int r = 0; r < numberOfRows; r++)
+		for (int c = 0; c < width; c++)
+			if (rows[r][c] == 'o')
+				hole[r * width + c] = g.NumberOfHoles++;
+
+	const int dr[4] = { -1, 0, 0, 1 };
+	const int dc[4] = { 0, -1, 1, 0 };
+	for (int r = 0; r < numberOfRows; r++) {
+		for (int c = 0; c < width; c++) {
+			for (int d = 0; d < 4; d++) {
+				int r2 = r + 2 * dr[d], c2 = c + 2 * dc[d];
+				if (hole[r * width + c] < 0 || r2 < 0 || r2 >= numberOfRows || c2 < 0 || c2 >= width)
+					continue;
+				int jump = hole[(r + dr[d]) * width + c + dc[d]];
+				int to = hole[r2 * width + c2];
+				if (jump >= 0 && to >= 0)
+					g.AddMove(hole[r * width + c], jump, to);
+			}
+		}
+	}
+
+	std::string error;
+	if (!g.Derive(error)) {
+		std::cerr << g.Name << ": " << error << "\n";
+		return Geometry();
+	}
+	return g;
+}
+
+#ifndef PEGBOARD_NO_GENERATED_TABLES
+/// <summary>
+/// Geometry::FromGeneratedTables() builds the standard geometry by copying the tables of GeneratedTables.h; nothing is derived.
+/// </summary>
+/// <param name=""></param>
+/// <returns>The geometry</returns>
+Geometry Geometry::FromGeneratedTables(void) {
+	Geometry g;
+	g.Name = GENERATED_NAME;
+	g.NumberOfHoles = GENERATED_NUMBER_OF_HOLES;
+	g.moves.assign(GeneratedMoves, GeneratedMoves + GENERATED_NUMBER_OF_MOVES);
+	g.fromJumpMask.assign(GeneratedFromJumpMasks, GeneratedFromJumpMasks + GENERATED_NUMBER_OF_MOVES);
+	g.toMask.assign(GeneratedToMasks, GeneratedToMasks + GENERATED_NUMBER_OF_MOVES);
+	g.moveMask.assign(GeneratedMoveMasks, GeneratedMoveMasks + GENERATED_NUMBER_OF_MOVES);
+	g.moveIndex.assign(GeneratedMoveIndex, GeneratedMoveIndex + GENERATED_NUMBER_OF_HOLES * GENERATED_NUMBER_OF_HOLES);
+	g.movesOfHole.resize(GENERATED_NUMBER_OF_HOLES);
+	for (int h = 0; h < GENERATED_NUMBER_OF_HOLES; h++)
+		g.movesOfHole[h].assign(GeneratedMovesOfHole + GeneratedMovesOfHoleStart[h], GeneratedMovesOfHole + GeneratedMovesOfHoleStart[h + 1]);
+	g.symmetries.resize(GENERATED_NUMBER_OF_SYMMETRIES);
+	for (int s = 0; s < GENERATED_NUMBER_OF_SYMMETRIES; s++)
+		memcpy(g.symmetries[s].image, GeneratedSymmetries[s], GENERATED_NUMBER_OF_HOLES);
+	g.fitsPackedPath = (g.GetMoveBits() <= PACKED_MOVE_BITS) && (g.NumberOfHoles - 2 <= PACKED_PATH_CAPACITY);
+	g.solvable.assign(GeneratedSolvable, GeneratedSolvable + GENERATED_SOLVABLE_WORDS);
+	return g;
+}
+#endif
+
+//
+// Public Methods
+//
+
+/// <summary>
+/// Constructor.  Creates an empty geometry; use Load() or one of the factories.
+/// </summary>
+/// <param name=""></param>
+Geometry::Geometry(void) {
+}
+
+/// <summary>
+/// Geometry::Load() reads a geometry from a text file (see Geometry.h for the format).  Errors are reported on std::cerr.
+/// </summary>
+/// <param name="fileName">File to read</param>
+/// <returns>Returns true if the file describes a valid geometry; the geometry is left empty otherwise</returns>
+bool Geometry::Load(const char *fileName) {
+	std::ifstream file(fileName);
+	std::string line, error;
+	int lineNumber = 0;
+
+	*this = Geometry();
+	Name = fileName;
+	if (!file) {
+		std::cerr << fileName << ": cannot open the file\n";
+		return false;
+	}
+
+	while (error.empty() && std::getline(file, line)) {
+		lineNumber++;
+		size_t comment = line.find('#');
+		if (comment != std::string::npos)
+			line.erase(comment);
+		std::istringstream in(line);
+		std::string keyword;
+		if (!(in >> keyword))
+			continue;
+
+		int a, b, c;
+		if (keyword == "name") {
+			in >> Name;
+		}
+		else if (keyword == "holes") {
+			if (!(in >> a) || a < 1 || a > MAX_NUMBER_OF_PEGS || NumberOfHoles != 0)
+				error = "expected \"holes <n>\" once, with 1 <= n <= " + std::to_string(MAX_NUMBER_OF_PEGS);
+			else
+				NumberOfHoles = a;
+		}
+		else if (keyword == "line" || keyword == "jump") {
+			if (NumberOfHoles == 0)
+				error = "\"holes <n>\" must come first";
+			else if (!(in >> a >> b >> c) || !AddMove(a, b, c) || (keyword == "line" && !AddMove(c, b, a)))
+				error = "expected \"" + keyword + " <a> <b> <c>\" with three distinct holes below " + std::to_string(NumberOfHoles);
+		}
+		else {
+			error = "unknown statement \"" + keyword + "\"";
+		}
+		if (!error.empty())
+			error = "line " + std::to_string(lineNumber) + ": " + error;
+	}
+
+	if (error.empty() && NumberOfHoles == 0)
+		error = "no \"holes <n>\" statement";
+	if (error.empty())
+		Derive(error);
+	if (!error.empty()) {
+		std::cerr << fileName << ": " << error << "\n";
+		*this = Geometry();
+		return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// Geometry::Triangle() builds a triangular board with the specified number of rows.  Holes are numbered row by row from the apex,
+/// and moves jump two holes along a row or either diagonal.  Triangle(5) is the 15-hole Cracker Barrel board.
+/// </summary>
+/// <param name="rows">Number of rows, 1 to 10 (a typeBoardKey holds at most MAX_NUMBER_OF_PEGS holes)</param>
+/// <returns>The geometry, or an empty geometry if it is not valid</returns>
+Geometry Geometry::Triangle(int rows) {
+	Geometry g;
+	g.Name = "Triangle" + std::to_string(rows * (rows + 1) / 2);
+	g.NumberOfHoles = rows * (rows + 1) / 2;
+
+	// Hole (r, c), 0 <= c <= r, is number r * (r + 1) / 2 + c
+	const int dr[6] = { -1, -1, 0, 0, 1, 1 };
+	const int dc[6] = { -1, 0, -1, 1, 0, 1 };
+	for (int r = 0; r < rows; r++) {
+		for (int c = 0; c <= r; c++) {
+			for (int d = 0; d < 6; d++) {
+				int r2 = r + 2 * dr[d], c2 = c + 2 * dc[d];
+				if (r2 < 0 || r2 >= rows || c2 < 0 || c2 > r2)
+					continue;
+				g.AddMove(r * (r + 1) / 2 + c, (r + dr[d]) * (r + dr[d] + 1) / 2 + c + dc[d], r2 * (r2 + 1) / 2 + c2);
+			}
+		}
+	}
+
+	std::string error;
+	if (!g.Derive(error)) {
+		std::cerr << g.Name << ": " << error << "\n";
+		return Geometry();
+	}
+	return g;
+}
+
+/// <summary>
+/// Geometry::English() builds the 33-hole English (cross-shaped) board.  The center hole is 16.
+/// </summary>
+/// <param name=""></param>
+/// <returns>The geometry</returns>
+Geometry Geometry::English(void) {
+	const char *rows[] = {
+		"..ooo..",
+		"..ooo..",
+		"ooooooo",
+		"ooooooo",
+		"ooooooo",
+		"..ooo..",
+		"..ooo.." };
+	return FromGrid("English33", rows, 7);
+}
+
+/// <summary>
+/// Geometry::European() builds the 37-hole European (French) board.  The center hole is 18.
+/// </summary>
+/// <param name=""></param>
+/// <returns>The geometry</returns>
+Geometry Geometry::European(void) {
+	const char *rows[] = {
+		"..ooo..",
+		".ooooo.",
+		"ooooooo",
+		"ooooooo",
+		"ooooooo",
+		".ooooo.",
+		"..ooo.." };
+	return FromGrid("European37", rows, 7);
+}
+
+/// <summary>
+/// Geometry::Standard() returns the 15-hole triangle, shared by every PegBoard that has not been given another geometry.
+/// It is copied from GeneratedTables.h, solvability table included, unless built with PEGBOARD_NO_GENERATED_TABLES (as Tools/GenerateTables.cpp is).
+/// </summary>
+/// <param name=""></param>
+/// <returns>The standard geometry</returns>
+const Geometry &Geometry::Standard(void) {
+#ifdef PEGBOARD_NO_GENERATED_TABLES
+	static const Geometry standard = Triangle(5);
+#else
+	static const Geometry standard = FromGeneratedTables();
+#endif
+	return standard;
+}
+
+/// <summary>
+/// Geometry::VerifyStandard() checks the standard geometry against a reference built at runtime by Triangle(5) and BuildSolvabilityTable().
+/// Used to make sure GeneratedTables.h is up to date.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Returns true if every table matches</returns>
+bool Geometry::VerifyStandard(void) {
+	Geometry reference = Triangle(5);
+	reference.BuildSolvabilityTable();
+	bool match = Standard().Matches(reference);
+	std::cout << "Standard Tables: " << (match ? "match" : "DO NOT MATCH") << " the runtime-built " << reference.GetName() << "\n";
+	return match;
+}
+
+/// <summary>
+/// Geometry::Matches() compares every table of two geometries (but not their names).
+/// </summary>
+/// <param name="g">Geometry to compare to</param>
+/// <returns>Returns true if the geometries have the same holes, moves, derived tables, symmetries and solvability table</returns>
+bool Geometry::Matches(const Geometry &g) const {
+	if (NumberOfHoles != g.NumberOfHoles || moves.size() != g.moves.size() || symmetries.size() != g.symmetries.size())
+		return false;
+	for (size_t i = 0; i < moves.size(); i++) {
+		if (moves[i].from != g.moves[i].from || moves[i].to != g.moves[i].to || moves[i].jump != g.moves[i].jump)
+			return false;
+	}
+	for (size_t s = 0; s < symmetries.size(); s++) {
+		if (memcmp(symmetries[s].image, g.symmetries[s].image, NumberOfHoles) != 0)
+			return false;
+	}
+	return (fromJumpMask == g.fromJumpMask) && (toMask == g.toMask) && (moveMask == g.moveMask) && (moveIndex == g.moveIndex)
+		&& (movesOfHole == g.movesOfHole) && (fitsPackedPath == g.fitsPackedPath) && (solvable == g.solvable);
+}
+
+/// <summary>
+/// Geometry::GetName() returns the name of the geometry.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+const char *Geometry::GetName(void) const {
+	return Name.c_str();
+}
+
+/// <summary>
+/// Geometry::GetNumberOfHoles() returns the number of holes of the board.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int Geometry::GetNumberOfHoles(void) const {
+	return NumberOfHoles;
+}
+
+/// <summary>
+/// Geometry::GetNumberOfMoves() returns the number of possible moves on the board.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int Geometry::GetNumberOfMoves(void) const {
+	return (int)moves.size();
+}
+
+/// <summary>
+/// Geometry::GetMove() returns move i.  Moves are sorted by (from, to).
+/// </summary>
+/// <param name="i">Index of the move, 0 to GetNumberOfMoves() - 1</param>
+/// <returns>The i-th possible move</returns>
+Move Geometry::GetMove(int i) const {
+	return moves[i];
+}
+
+/// <summary>
+/// Geometry::GetMoves() returns the moves as an array of GetNumberOfMoves() entries.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+const Move *Geometry::GetMoves(void) const {
+	return moves.data();
+}
+
+/// <summary>
+/// Geometry::GetFromJumpMasks() returns, for each move, the pegs that must be Full for the move to be legal.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+const typeBoardKey *Geometry::GetFromJumpMasks(void) const {
+	return fromJumpMask.data();
+}
+
+/// <summary>
+/// Geometry::GetToMasks() returns, for each move, the hole that must be Empty for the move to be legal.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+const typeBoardKey *Geometry::GetToMasks(void) const {
+	return toMask.data();
+}
+
+/// <summary>
+/// Geometry::GetMoveMasks() returns, for each move, the holes it changes.  XOR-ing the mask into a packed board on which the move is legal performs the move.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+const typeBoardKey *Geometry::GetMoveMasks(void) const {
+	return moveMask.data();
+}
+
+/// <summary>
+/// Geometry::GetMoveIndex() is the reverse of GetMove(): it finds the move that jumps from <from> to <to>.
+/// </summary>
+/// <param name="from">Hole of the peg that moves</param>
+/// <param name="to">Hole where the peg lands</param>
+/// <returns>Index of the move, or -1 if there is no such move</returns>
+int Geometry::GetMoveIndex(int from, int to) const {
+	return moveIndex[from * NumberOfHoles + to];
+}
+
+/// <summary>
+/// Geometry::GetMovesOfHole() returns the moves in which the specified hole is the from, jump or to hole, i.e. the moves whose legality changes with that hole.
+/// </summary>
+/// <param name="hole">Hole of the board</param>
+/// <returns>Indices of the moves, in increasing order</returns>
+const std::vector <int> &Geometry::GetMovesOfHole(int hole) const {
+	return movesOfHole[hole];
+}
+
+/// <summary>
+/// Geometry::GetFullBoard() returns the packed board with every hole Full.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+typeBoardKey Geometry::GetFullBoard(void) const {
+	return (NumberOfHoles == MAX_NUMBER_OF_PEGS) ? ~(typeBoardKey)0 : (((typeBoardKey)1 << NumberOfHoles) - 1);
+}
+
+/// <summary>
+/// Geometry::GetNumberOfSymmetries() returns the number of symmetries of the board, including the identity.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int Geometry::GetNumberOfSymmetries(void) const {
+	return (int)symmetries.size();
+}
+
+/// <summary>
+/// Geometry::GetSymmetry() returns symmetry s.
+/// </summary>
+/// <param name="s">Index of the symmetry, 0 to GetNumberOfSymmetries() - 1</param>
+/// <returns></returns>
+const Symmetry &Geometry::GetSymmetry(int s) const {
+	return symmetries[s];
+}
+
+/// <summary>
+/// Geometry::Transform() applies symmetry s to a packed board.
+/// </summary>
+/// <param name="key">Packed board</param>
+/// <param name="s">Index of the symmetry</param>
+/// <returns>Packed image of the board</returns>
+typeBoardKey Geometry::Transform(typeBoardKey key, int s) const {
+	const unsigned char *image = symmetries[s].image;
+	typeBoardKey r = 0;
+	while (key != 0) {
+		int i = std::countr_zero(key);
+		r |= ((typeBoardKey)1 << image[i]);
+		key &= key - 1;
+	}
+	return r;
+}
+
+/// <summary>
+/// Geometry::Canonical() returns the smallest image of a packed board under the symmetries.  Boards that are symmetric to one another
+/// have the same canonical board, and a board is solvable if and only if its canonical board is.
+/// </summary>
+/// <param name="key">Packed board</param>
+/// <returns>Canonical packed board</returns>
+typeBoardKey Geometry::Canonical(typeBoardKey key) const {
+	typeBoardKey best = key;
+	for (int s = 0; s < (int)symmetries.size(); s++) {
+		typeBoardKey t = Transform(key, s);
+		if (t < best)
+			best = t;
+	}
+	return best;
+}
+
+/// <summary>
+/// Geometry::GetKeyBits() returns the number of bits needed to store a board.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int Geometry::GetKeyBits(void) const {
+	return NumberOfHoles;
+}
+
+/// <summary>
+/// Geometry::GetMoveBits() returns the number of bits needed to store a move (its index).
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+int Geometry::GetMoveBits(void) const {
+	return moves.size() > 1 ? (int)std::bit_width(moves.size() - 1) : 1;
+}
+
+/// <summary>
+/// Geometry::FitsPackedPath() checks that a PackedPath can hold every move index and the longest possible game (NumberOfHoles - 2 moves).
+/// When it cannot, PegBoard does not record paths; counts are still exact.  Build with PEGBOARD_LARGE_GEOMETRY to widen PackedPath.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+bool Geometry::FitsPackedPath(void) const {
+	return fitsPackedPath;
+}
+
+/// <summary>
+/// Geometry::BuildSolvabilityTable() decides, for every board of the geometry, whether it can be reduced to a single peg.
+/// A move removes a peg, so boards are visited by increasing number of pegs and every child is decided before its parent.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Returns false (and builds nothing) if the board has more than SOLVABILITY_TABLE_MAX_HOLES holes</returns>
+bool Geometry::BuildSolvabilityTable(void) {
+	if (NumberOfHoles > SOLVABILITY_TABLE_MAX_HOLES)
+		return false;
+
+	typeBoardKey boards = (typeBoardKey)1 << NumberOfHoles;
+	solvable.assign((size_t)((boards + 63) / 64), 0);
+	for (int pegs = 1; pegs <= NumberOfHoles; pegs++) {
+		typeBoardKey key = ((typeBoardKey)1 << pegs) - 1;
+		while (key < boards) {
+			bool s = (pegs == 1);
+			for (size_t i = 0; i < moves.size() && !s; i++) {
+				if ((key & fromJumpMask[i]) == fromJumpMask[i] && (key & toMask[i]) == 0)
+					s = IsSolvable(key ^ moveMask[i]);
+			}
+			if (s)
+				solvable[key / 64] |= 1ULL << (key % 64);
+
+			// next board with the same number of pegs
+			typeBoardKey low = key & (~key + 1);
+			typeBoardKey ripple = key + low;
+			key = (((ripple ^ key) >> 2) / low) | ripple;
+		}
+	}
+	return true;
+}
+
+/// <summary>
+/// Geometry::HasSolvabilityTable() checks if the solvability table has been built (always for Geometry::Standard()).
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+bool Geometry::HasSolvabilityTable(void) const {
+	return !solvable.empty();
+}
+
+/// <summary>
+/// Geometry::IsSolvable() looks a board up in the solvability table, which must have been built.
+/// </summary>
+/// <param name="key">Packed board</param>
+/// <returns>Returns true if the board can be reduced to a single peg</returns>
+bool Geometry::IsSolvable(typeBoardKey key) const {
+	return ((solvable[key / 64] >> (key % 64)) & 1) != 0;
+}
+
+/// <summary>
+/// Geometry::GetSolvabilityTable() returns the solvability table, one bit per board (bit k % 64 of word k / 64 for board k).
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+const std::vector <unsigned long long> &Geometry::GetSolvabilityTable(void) const {
+	return solvable;
+}
+
+/// <summary>
+/// Geometry::ShowGeometry() displays the size of the board and of its derived tables.
+/// </summary>
+/// <param name=""></param>
+void Geometry::ShowGeometry(void) const {
+	std::cout << "Geometry: " << Name << ", " << NumberOfHoles << " holes, " << moves.size() << " moves, " << symmetries.size() << " symmetries\n";
+	std::cout << "Geometry Storage: " << GetKeyBits() << " bits per board, " << GetMoveBits() << " bits per move";
+	if (!FitsPackedPath())
+		std::cout << " (paths are not recorded; build with PEGBOARD_LARGE_GEOMETRY)";
+	std::cout << "\n";
+}
@@ -0,0 +1,110 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include <string>
+#include <vector>
+#include "Board.h"
+
+#define NUMBER_OF_POSSIBLE_MOVES 36	// moves of the standard (5-row triangle) board
+#define MAX_NUMBER_OF_MOVES 256	// moves that fit in a PackedMove
+#define MAX_NUMBER_OF_SYMMETRIES 48	// the symmetry search stops here; square boards have 8, triangles 6, hexagons 12
+#define SOLVABILITY_TABLE_MAX_HOLES 24	// one bit per board: 2 MB at 24 holes
+
+struct Move {
+	int from;
+	int to;
+	int jump;
+};
+
+// A symmetry of the board: hole i is mapped to hole image[i], and every move onto a move
+struct Symmetry {
+	unsigned char image[MAX_NUMBER_OF_PEGS];
+};
+
+// Geometry describes a board as data: its holes (numbered 0 to GetNumberOfHoles() - 1, i.e. bit i of a typeBoardKey) and the moves between them.
+// Everything the solvers need is derived from the move list once, when the geometry is built: the bit masks of each move,
+// the reverse (from, to) -> move table, the symmetry group, and the number of bits needed to store a board and a move.
+// The 15-hole triangle is Geometry::Standard(); its tables, and the solvability of each of its boards, are pre-generated into
+// GeneratedTables.h, which is checked in and regenerated by hand with Tools/GenerateTables.cpp, so nothing is derived at startup.
+// Other boards come from the factories below or from a text file (see Load()); a board that is not valid is reported on std::cerr and left empty (no holes).
+//
+// File format, one statement per line, '#' starts a comment:
+//   name <word>           optional
+//   holes <n>             must come first
+//   line <a> <b> <c>      a, b, c in a straight line: adds the moves a over b to c and c over b to a
+//   jump <from> <over> <to>    adds a single move
+class Geometry
+{
+private:
+	std::string Name;
+	int NumberOfHoles = 0;
+	std::vector <Move> moves;	// sorted by (from, to)
+	std::vector <typeBoardKey> fromJumpMask;	// pegs that must be Full for move i
+	std::vector <typeBoardKey> toMask;	// hole that must be Empty for move i
+	std::vector <typeBoardKey> moveMask;	// holes changed by move i
+	std::vector <short> moveIndex;	// [from * NumberOfHoles + to] is the move from <from> to <to>, or -1
+	std::vector <std::vector <int> > movesOfHole;	// moves in which hole i is the from, jump or to hole
+	std::vector <Symmetry> symmetries;	// the identity is always among them
+	bool fitsPackedPath = false;	// see FitsPackedPath()
+	std::vector <unsigned long long> solvable;	// bit k is set when board k can be solved; empty until BuildSolvabilityTable()
+
+	bool AddMove(int from, int jump, int to);
+	bool Derive(std::string &error);
+	void FindSymmetries(void);
+	void ExtendSymmetry(const std::vector <int> &order, int depth, int *image, bool *used);
+	static Geometry FromGrid(const char *name, const char **rows, int numberOfRows);
+	static Geometry FromGeneratedTables(void);
+
+public:
+	Geometry(void);
+
+	bool Load(const char *fileName);
+	static Geometry Triangle(int rows);
+	static Geometry English(void);
+	static Geometry European(void);
+	static const Geometry &Standard(void);
+	static bool VerifyStandard(void);
+	bool Matches(const Geometry &g) const;
+
+	const char *GetName(void) const;
+	int GetNumberOfHoles(void) const;
+	int GetNumberOfMoves(void) const;
+	Move GetMove(int i) const;
+	const Move *GetMoves(void) const;
+	const typeBoardKey *GetFromJumpMasks(void) const;
+	const typeBoardKey *GetToMasks(void) const;
+	const typeBoardKey *GetMoveMasks(void) const;
+	int GetMoveIndex(int from, int to) const;
+	const std::vector <int> &GetMovesOfHole(int hole) const;
+	typeBoardKey GetFullBoard(void) const;
+
+	int GetNumberOfSymmetries(void) const;
+	const Symmetry &GetSymmetry(int s) const;
+	typeBoardKey Transform(typeBoardKey key, int s) const;
+	typeBoardKey Canonical(typeBoardKey key) const;
+
+	int GetKeyBits(void) const;
+	int GetMoveBits(void) const;
+	bool FitsPackedPath(void) const;
+
+	bool BuildSolvabilityTable(void);
+	bool HasSolvabilityTable(void) const;
+	bool IsSolvable(typeBoardKey key) const;
+	const std::vector <unsigned long long> &GetSolvabilityTable(void) const;
+
+	void ShowGeometry(void) const;
+};
@@ -0,0 +1,236 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <iostream>
+#include "LookUpCache.h"
+
+/// <summary>
+/// Constructor.  The cache starts with the default budget and the TwoTier policy.
+/// </summary>
+/// <param name=""></param>
+LookUpCache::LookUpCache(void) {
+	SetBudget(LOOKUP_CACHE_DEFAULT_BUDGET, TwoTier);
+}
+
+/// <summary>
+/// LookUpCache::SetBudget() sizes the table to fit in the specified number of bytes and selects the replacement policy.  The cache is emptied.
+/// The table itself is allocated by the first Store(), so a solver that never stores a board (e.g. one answering from a solvability table) never pays for it.
+/// The budget must hold at least one bucket (sizeof(CacheEntry) bytes, twice that for TwoTier); a smaller budget is rejected and the cache is left unchanged.
+/// </summary>
+/// <param name="bytes">Hard memory budget for the table</param>
+/// <param name="replacement">Replacement policy</param>
+/// <returns>Returns false if the budget is smaller than one bucket</returns>
+bool LookUpCache::SetBudget(size_t bytes, CACHEPOLICY replacement) {
+	int bucketWays = (replacement == TwoTier) ? 2 : 1;
+	if (bytes < sizeof(CacheEntry) * bucketWays) {
+		std::cerr << "Look up budget of " << bytes << " bytes is smaller than one bucket (" << sizeof(CacheEntry) * bucketWays << " bytes)\n";
+		return false;
+	}
+
+	policy = replacement;
+	ways = bucketWays;
+	numBuckets = bytes / (sizeof(CacheEntry) * ways);
+
+	std::vector <CacheEntry> table;
+	entries.swap(table);
+	Clear();
+	return true;
+}
+
+/// <summary>
+/// LookUpCache::Clear() empties the cache and resets its counters.
+/// </summary>
+/// <param name=""></param>
+void LookUpCache::Clear(void) {
+	CacheEntry empty = { 0, 0, -1, 0 };
+	for (size_t i = 0; i < entries.size(); i++)
+		entries[i] = empty;
+	numProbes = 0;
+	numHits = 0;
+	numCollisions = 0;
+	numStores = 0;
+	numEvictions = 0;
+	numRejected = 0;
+	numUsed = 0;
+}
+
+/// <summary>
+/// LookUpCache::Bucket() returns the first entry of the bucket for the specified board.
+/// </summary>
+/// <param name="key">Packed board</param>
+/// <returns>Pointer to the bucket's entries</returns>
+CacheEntry *LookUpCache::Bucket(typeBoardKey key) {
+	key ^= key >> 31;
+	key *= 0x7fb5d329728ea185ULL;
+	key ^= key >> 27;
+	return &entries[(size_t)(key % numBuckets) * ways];
+}
+
+/// <summary>
+/// LookUpCache::Probe() looks up a board.
+/// </summary>
+/// <param name="key">Packed board</param>
+/// <param name="vacancy">Receives the starting vacancy that stored the board (may be NULL)</param>
+/// <returns>Returns true if the board is in the cache</returns>
+bool LookUpCache::Probe(typeBoardKey key, int *vacancy) {
+	bool occupied = false;
+
+	numProbes++;
+	if (entries.empty())
+		return false;
+	CacheEntry *bucket = Bucket(key);
+	for (int i = 0; i < ways; i++) {
+		if (bucket[i].used && bucket[i].key == key) {
+			numHits++;
+			if (vacancy != NULL)
+				*vacancy = bucket[i].vacancy;
+			return true;
+		}
+		occupied = occupied || bucket[i].used;
+	}
+	if (occupied)
+		numCollisions++;
+	return false;
+}
+
+/// <summary>
+/// LookUpCache::Store() stores a board, making room according to the replacement policy.
+/// </summary>
+/// <param name="key">Packed board</param>
+/// <param name="depth">Pegs on the board</param>
+/// <param name="vacancy">Starting vacancy of the current search</param>
+void LookUpCache::Store(typeBoardKey key, int depth, int vacancy) {
+	if (entries.empty()) {
+		CacheEntry empty = { 0, 0, -1, 0 };
+		entries.assign(numBuckets * ways, empty);
+	}
+	CacheEntry *bucket = Bucket(key);
+	CacheEntry entry = { key, (unsigned char)depth, (signed char)vacancy, 1 };
+
+	for (int i = 0; i < ways; i++) {
+		if (bucket[i].used && bucket[i].key == key)
+			return;
+	}
+
+	CacheEntry *slot = &bucket[0];
+	if (policy == DepthPreferred && slot->used && slot->depth > depth) {
+		numRejected++;
+		return;
+	}
+	if (policy == TwoTier && slot->used) {
+		// The depth-preferred entry keeps the deeper board; the other one goes to the always-replace entry
+		if (slot->depth > depth) {
+			slot = &bucket[1];
+		}
+		else {
+			if (bucket[1].used)
+				numEvictions++;
+			else
+				numUsed++;
+			bucket[1] = bucket[0];
+			bucket[0] = entry;
+			numStores++;
+			return;
+		}
+	}
+
+	if (slot->used)
+		numEvictions++;
+	else
+		numUsed++;
+	*slot = entry;
+	numStores++;
+}
+
+/// <summary>
+/// LookUpCache::GetSize() returns the number of boards in the cache.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+long long LookUpCache::GetSize(void) {
+	return numUsed;
+}
+
+/// <summary>
+/// LookUpCache::GetCapacity() returns the number of boards the cache can hold.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+size_t LookUpCache::GetCapacity(void) {
+	return numBuckets * ways;
+}
+
+/// <summary>
+/// LookUpCache::GetBytes() returns the memory used by the table once it is allocated.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+size_t LookUpCache::GetBytes(void) {
+	return GetCapacity() * sizeof(CacheEntry);
+}
+
+/// <summary>
+/// LookUpCache::GetNumberOfHits() returns the number of look ups that found their board since the cache was cleared.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+long long LookUpCache::GetNumberOfHits(void) {
+	return numHits;
+}
+
+/// <summary>
+/// LookUpCache::GetNumberOfCollisions() returns the number of look ups that missed in a bucket holding other boards since the cache was cleared.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+long long LookUpCache::GetNumberOfCollisions(void) {
+	return numCollisions;
+}
+
+/// <summary>
+/// LookUpCache::GetNumberOfEvictions() returns the number of boards overwritten since the cache was cleared.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+long long LookUpCache::GetNumberOfEvictions(void) {
+	return numEvictions;
+}
+
+/// <summary>
+/// LookUpCache::ShowStatistics() displays the size and counters of the cache.
+/// </summary>
+/// <param name=""></param>
+void LookUpCache::ShowStatistics(void) {
+	const char *names[] = { "DepthPreferred", "AlwaysReplace", "TwoTier" };
+	std::cout << "Look Up Cache: " << GetBytes() << " bytes, " << GetCapacity() << " entries, " << names[policy] << "\n";
+	std::cout << "Look Up Cache Probes: " << numProbes << " (" << numHits << " hits, " << numCollisions << " collisions)\n";
+	std::cout << "Look Up Cache Stores: " << numStores << " (" << numEvictions << " evictions, " << numRejected << " rejected)\n";
+}
+
+/// <summary>
+/// LookUpCache::ShowBoards() displays every board in the cache.  Used for debugging purposes.
+/// </summary>
+/// <param name="numberOfHoles">Holes of the boards' geometry</param>
+void LookUpCache::ShowBoards(int numberOfHoles) {
+	Board node;
+	node.Initialize(0, numberOfHoles);
+	for (size_t i = 0; i < entries.size(); i++) {
+		if (entries[i].used) {
+			node.SetKey(entries[i].key);
+			node.ShowBoard();
+		}
+	}
+}
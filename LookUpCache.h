@@ -0,0 +1,73 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Board.h"
+
+#define LOOKUP_CACHE_DEFAULT_BUDGET (16 << 20)	// bytes; large enough that the 15-hole board never evicts
+
+// How a full bucket makes room for a new board
+//   DepthPreferred: one entry per bucket; a new board replaces the old one only if its subtree is at least as deep (more pegs)
+//   AlwaysReplace:  one entry per bucket; a new board always replaces the old one
+//   TwoTier:        two entries per bucket; the first is depth-preferred, the second always-replace and receives what the first gives up
+enum CACHEPOLICY { DepthPreferred = 0, AlwaysReplace = 1, TwoTier = 2 };
+
+struct CacheEntry {
+	typeBoardKey key;	// packed board (see Board::GetKey())
+	unsigned char depth;	// pegs on the board; more pegs means a larger subtree is saved by a hit
+	signed char vacancy;	// starting vacancy whose search stored the board
+	unsigned char used;	// 1 if the entry holds a board
+};
+
+// LookUpCache is a fixed-size, hashed table of boards with a hard memory budget.  The table is allocated in full by the first Store()
+// and never grows; when a bucket is full, the replacement policy decides which board is kept.
+class LookUpCache
+{
+private:
+	std::vector <CacheEntry> entries;
+	size_t numBuckets = 0;
+	int ways = 1;	// entries per bucket
+	CACHEPOLICY policy = TwoTier;
+
+	long long numProbes = 0;	// look ups
+	long long numHits = 0;	// look ups that found the board
+	long long numCollisions = 0;	// look ups that missed in a bucket holding other boards
+	long long numStores = 0;	// boards stored
+	long long numEvictions = 0;	// boards overwritten by another board
+	long long numRejected = 0;	// boards not stored because the bucket held deeper boards
+	long long numUsed = 0;	// entries holding a board
+
+	CacheEntry *Bucket(typeBoardKey key);
+
+public:
+	LookUpCache(void);
+
+	bool SetBudget(size_t bytes, CACHEPOLICY replacement);
+	void Clear(void);
+	bool Probe(typeBoardKey key, int *vacancy);
+	void Store(typeBoardKey key, int depth, int vacancy);
+
+	long long GetSize(void);
+	size_t GetCapacity(void);
+	size_t GetBytes(void);
+	long long GetNumberOfHits(void);
+	long long GetNumberOfCollisions(void);
+	long long GetNumberOfEvictions(void);
+	void ShowStatistics(void);
+	void ShowBoards(int numberOfHoles);
+};
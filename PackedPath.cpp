@@ -0,0 +1,124 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "PackedPath.h"
+
+#define PACKED_MOVE_MASK ((1ULL << PACKED_MOVE_BITS) - 1)
+#define PACKED_LENGTH_MASK ((1ULL << PACKED_LENGTH_BITS) - 1)
+
+/// <summary>
+/// Constructor.  Creates an empty path.
+/// </summary>
+/// <param name=""></param>
+PackedPath::PackedPath(void) {
+	Clear();
+}
+
+/// <summary>
+/// PackedPath::Clear() empties the path.
+/// </summary>
+/// <param name=""></param>
+void PackedPath::Clear(void) {
+	for (int w = 0; w < PACKED_PATH_WORDS; w++)
+		words[w] = 0;
+}
+
+/// <summary>
+/// PackedPath::Push() appends a packed move to the end of the path.
+/// </summary>
+/// <param name="m">Packed move (index into the geometry's moves)</param>
+/// <returns>Returns false (and leaves the path unchanged) if the path already holds PACKED_PATH_CAPACITY moves</returns>
+bool PackedPath::Push(PackedMove m) {
+	int n = Length();
+	if (n >= PACKED_PATH_CAPACITY)
+		return false;
+
+	int bit = PACKED_PATH_BITS - PACKED_MOVE_BITS * (n + 1);	// lowest bit of move n
+	int w = PACKED_PATH_WORDS - 1 - bit / 64;
+	unsigned long long v = (unsigned long long)m & PACKED_MOVE_MASK;
+	words[w] |= v << (bit % 64);
+	if (bit % 64 + PACKED_MOVE_BITS > 64)
+		words[w - 1] |= v >> (64 - bit % 64);	// the move straddles two words
+	words[PACKED_PATH_WORDS - 1] += 1;	// length
+	return true;
+}
+
+/// <summary>
+/// PackedPath::Get() returns the i-th move of the path.
+/// </summary>
+/// <param name="i">Index of the move, 0 to Length() - 1</param>
+/// <returns>Packed move (index into the geometry's moves)</returns>
+PackedMove PackedPath::Get(int i) const {
+	int bit = PACKED_PATH_BITS - PACKED_MOVE_BITS * (i + 1);
+	int w = PACKED_PATH_WORDS - 1 - bit / 64;
+	unsigned long long v = words[w] >> (bit % 64);
+	if (bit % 64 + PACKED_MOVE_BITS > 64)
+		v |= words[w - 1] << (64 - bit % 64);
+	return (PackedMove)(v & PACKED_MOVE_MASK);
+}
+
+/// <summary>
+/// PackedPath::Length() returns the number of moves in the path.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Number of moves</returns>
+int PackedPath::Length(void) const {
+	return (int)(words[PACKED_PATH_WORDS - 1] & PACKED_LENGTH_MASK);
+}
+
+/// <summary>
+/// PackedPath::Hash() mixes the words into a hash value, e.g. to keep paths in an unordered container.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Hash value</returns>
+size_t PackedPath::Hash(void) const {
+	unsigned long long h = 0;
+	for (int w = 0; w < PACKED_PATH_WORDS; w++)
+		h = h * 0x9E3779B97F4A7C15ULL ^ words[w];
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return (size_t)h;
+}
+
+/// <summary>
+/// PackedPath::operator==() compares two paths move by move.
+/// </summary>
+bool PackedPath::operator==(const PackedPath &p) const {
+	for (int w = 0; w < PACKED_PATH_WORDS; w++) {
+		if (words[w] != p.words[w])
+			return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// PackedPath::operator!=() is the negation of operator==().
+/// </summary>
+bool PackedPath::operator!=(const PackedPath &p) const {
+	return !(*this == p);
+}
+
+/// <summary>
+/// PackedPath::operator<() orders paths lexicographically by their packed moves.
+/// </summary>
+bool PackedPath::operator<(const PackedPath &p) const {
+	for (int w = 0; w < PACKED_PATH_WORDS; w++) {
+		if (words[w] != p.words[w])
+			return words[w] < p.words[w];
+	}
+	return false;
+}
@@ -0,0 +1,62 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include <cstddef>
+#include <functional>
+
+// Build with PEGBOARD_LARGE_GEOMETRY defined to keep full paths on boards with more than 64 moves or more than 22 holes (see Geometry::FitsPackedPath())
+#ifdef PEGBOARD_LARGE_GEOMETRY
+#define PACKED_MOVE_BITS 7	// a packed move is an index into the geometry's moves (up to 128 moves, e.g. the 76 of the English board)
+#define PACKED_PATH_WORDS 4
+#else
+#define PACKED_MOVE_BITS 6	// a packed move is an index into the geometry's moves (the 36 moves of the 15-hole board fit in 6 bits)
+#define PACKED_PATH_WORDS 2
+#endif
+#define PACKED_LENGTH_BITS 6	// number of moves in a packed path
+#define PACKED_PATH_BITS (64 * PACKED_PATH_WORDS)
+#define PACKED_PATH_CAPACITY ((PACKED_PATH_BITS - PACKED_LENGTH_BITS) / PACKED_MOVE_BITS)	// 20 moves (35 when large); a 15-hole game has at most 13
+
+typedef unsigned char PackedMove;
+
+// PackedPath stores a sequence of packed moves in PACKED_PATH_WORDS 64-bit words.
+// The first move occupies the most significant bits and the length the least significant bits, so comparing the words
+// orders paths lexicographically by their moves (a path sorts before its extensions).  Unused move bits are zero.
+class PackedPath
+{
+private:
+	unsigned long long words[PACKED_PATH_WORDS] = {};	// words[0] holds the most significant bits; the low bits of the last word hold the length
+
+public:
+	PackedPath(void);
+
+	void Clear(void);
+	bool Push(PackedMove m);
+	PackedMove Get(int i) const;
+	int Length(void) const;
+	size_t Hash(void) const;
+
+	bool operator==(const PackedPath &p) const;
+	bool operator!=(const PackedPath &p) const;
+	bool operator<(const PackedPath &p) const;
+};
+
+namespace std {
+	template <>
+	struct hash <PackedPath> {
+		size_t operator()(const PackedPath &p) const { return p.Hash(); }
+	};
+}
@@ -27,7 +27,7 @@
 /// <summary>
 /// PegBoard::ValidMove() determines if Move m is valid.
 /// Be definition, a move is valid if m.from and m.jump is Full and m.to isEmpty.  
-/// Move m is taken from PossibleMoves[], so there is no need to check if m.to, m.jump, and m.from are in a straight line.
+/// Move m is taken from the geometry's moves, so there is no need to check if m.to, m.jump, and m.from are in a straight line.
 /// </summary>
 /// <param name="m">Move of which to determine validity</param>
 /// <returns>Returns true/false if Move m is a valid/invalid move</returns>
@@ -42,12 +42,7 @@ bool PegBoard::ValidMove(Move m) {
 /// <param name=""></param>
 /// <returns>returns int of how many Pegs remain on the board</returns>
 int PegBoard::RemainingPegs(void) {
-	int cnt = 0;
-	for (int i = 0; i < NumberOfPegs; i++) {
-		if (board.isFull(i))
-			cnt++;
-	}
-	return cnt;
+	return board.RemainingPegs();
 }
 
 //
@@ -63,6 +58,52 @@ Board PegBoard::GetBoard(void) {
 	return board;
 }
 
+/// <summary>
+/// PegBoard::GetKey() returns the board packed into a typeBoardKey (see Board::GetKey()).
+/// </summary>
+/// <param name=""></param>
+/// <returns>Packed representation of the board</returns>
+typeBoardKey PegBoard::GetKey(void) {
+	return board.GetKey();
+}
+
+/// <summary>
+/// PegBoard::SetKey() sets the board from a packed typeBoardKey.  The path to the board is cleared since it is not part of the key.
+/// </summary>
+/// <param name="key">Packed board to unpack</param>
+void PegBoard::SetKey(typeBoardKey key) {
+	board.SetKey(key);
+	pathTo.Clear();
+	boardSolvable = false;
+}
+
+/// <summary>
+/// PegBoard::GetPossibleMove() returns possible move i of the board's geometry.
+/// </summary>
+/// <param name="i">Index of the move, 0 to GetGeometry()->GetNumberOfMoves() - 1</param>
+/// <returns>The i-th possible move</returns>
+Move PegBoard::GetPossibleMove(int i) {
+	return geometry->GetMove(i);
+}
+
+/// <summary>
+/// PegBoard::SetGeometry() selects the board's geometry.  The geometry is not copied and must outlive the PegBoard; call Initialize() afterwards.
+/// If Geometry::FitsPackedPath() is false, paths are not recorded (counts are not affected).
+/// </summary>
+/// <param name="g">Geometry of the board</param>
+void PegBoard::SetGeometry(const Geometry *g) {
+	geometry = g;
+}
+
+/// <summary>
+/// PegBoard::GetGeometry() returns the board's geometry.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+const Geometry *PegBoard::GetGeometry(void) {
+	return geometry;
+}
+
 /// <summary>
 ///  PegBoard::GetPeg() returns the PEGSTATUS value of the specified Peg position
 /// </summary>
@@ -99,11 +140,13 @@ bool PegBoard::IsBoardSolvable(void) {
 }
 
 /// <summary>
-/// PegBoard::AddToPath() adds a move to the end of the std::list pathTo.  pathTo contains moves performed to get from starting configuration to current configuration.
+/// PegBoard::AddToPath() adds a move to the end of the PackedPath pathTo.  pathTo contains moves performed to get from starting configuration to current configuration.
+/// Nothing is recorded if the geometry's moves do not fit in a PackedPath (see Geometry::FitsPackedPath()).
 /// </summary>
 /// <param name="m"></param>
 void PegBoard::AddToPath(Move m) {
-	pathTo.push_back(m);
+	if (geometry->FitsPackedPath())
+		pathTo.Push(EncodeMove(m));
 }
 
 /// <summary>
@@ -111,21 +154,55 @@ void PegBoard::AddToPath(Move m) {
 /// </summary>
 /// <param name=""></param>
 void PegBoard::ShowPathTo(void) {
-	typeListOfMoves::iterator it;
+	ShowPath(pathTo);
+}
+
+/// <summary>
+/// PegBoard::GetPath() returns the moves performed to get from the initial (starting) configuration to the current configuration.
+/// </summary>
+/// <param name=""></param>
+/// <returns>PackedPath pathTo</returns>
+PackedPath PegBoard::GetPath(void) {
+	return pathTo;
+}
+
+/// <summary>
+/// PegBoard::ShowPath() displays the moves of the specified path, e.g. a solution kept by PegBoardSolver.
+/// </summary>
+/// <param name="path">Path to display</param>
+void PegBoard::ShowPath(PackedPath path) {
 	Move currentMove;
-	for (it = pathTo.begin(); it != pathTo.end(); it++) {
-		currentMove = *it;
+	for (int i = 0; i < path.Length(); i++) {
+		currentMove = DecodeMove(path.Get(i));
 		std::cout << currentMove.from << "  " << currentMove.to << "; ";
 	}
 	std::cout << "\n";
 }
 
+/// <summary>
+/// PegBoard::EncodeMove() packs a move into its index in the geometry's moves.
+/// </summary>
+/// <param name="m">Move taken from the geometry</param>
+/// <returns>Packed move</returns>
+PackedMove PegBoard::EncodeMove(Move m) {
+	return (PackedMove)geometry->GetMoveIndex(m.from, m.to);
+}
+
+/// <summary>
+/// PegBoard::DecodeMove() is the reverse of PegBoard::EncodeMove().
+/// </summary>
+/// <param name="m">Packed move</param>
+/// <returns>Move from the geometry</returns>
+Move PegBoard::DecodeMove(PackedMove m) {
+	return geometry->GetMove(m);
+}
+
 /// <summary>
 /// PegBoard::Initialize() initializes Board::board (specifies the starting vacancy) and any appropriate private variables of Class PegBoard.
 /// </summary>
 /// <param name="emptyPeg">Starting Vacancy</param>
 void PegBoard::Initialize(int emptyPeg) {
-	board.Initialize(emptyPeg);
+	board.Initialize(emptyPeg, geometry->GetNumberOfHoles());
 	boardSolvable = false;
 }
 
@@ -142,12 +219,12 @@ bool PegBoard::isSolved() {
 
 
 /// <summary>
-/// PegBoard::CopyBoard() performs a hard/deep copy of the board contained by a specified PegBoard
+/// PegBoard::CopyBoard() performs a hard/deep copy of the board contained by a specified PegBoard.  The geometry is shared, not copied.
 /// </summary>
 /// <param name="src">PegBoard to be copied</param>
 void PegBoard::CopyBoard(PegBoard src) {
-	for (int i = 0; i < NumberOfPegs; i++)
-		SetPeg(i, src.GetPeg(i));
+	board = src.board;
+	geometry = src.geometry;
 	pathTo = src.pathTo;
 	boardSolvable = src.boardSolvable;
 }
@@ -162,16 +239,20 @@ void PegBoard::ShowBoard(void) {
 
 /// <summary>
 ///  PegBoard::GetAvailableMoves() places all possible moves into a list after determining if the move is valid.
-/// Future Optimization: Update the list of possible moves in a smarter, more efficient manner instead of going through PossibleMoves[]
+/// Legality is tested with the geometry's bit masks against the packed board, one AND per move.
 /// Future Optimization: Return a pointer to the list of available moves.  
 /// </summary>
 /// <param name=""></param>
 /// <returns>Returns a list of Moves (typeListOfMoves), not a pointer to typeListOfMoves</returns>
 typeListOfMoves PegBoard::GetAvailableMoves(void) {
 	typeListOfMoves mlist;
-	for (int i = 0; i < NUMBER_OF_POSSIBLE_MOVES; i++) {
-		if (ValidMove(PossibleMoves[i])) {
-			mlist.push_back(PossibleMoves[i]);
+	const Move *moves = geometry->GetMoves();
+	const typeBoardKey *fromJump = geometry->GetFromJumpMasks();
+	const typeBoardKey *to = geometry->GetToMasks();
+	typeBoardKey key = board.GetKey();
+	for (int i = 0; i < geometry->GetNumberOfMoves(); i++) {
+		if ((key & fromJump[i]) == fromJump[i] && (key & to[i]) == 0) {
+			mlist.push_back(moves[i]);
 		}
 	}
 	return mlist;
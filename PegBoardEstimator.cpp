@@ -0,0 +1,254 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <iostream>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "PegBoardEstimator.h"
+#include "PegBoard.h"
+
+#define CONFIDENCE_Z 1.96	// 95% confidence intervals
+
+/// <summary>
+/// Constructor.  Explicitly initializes the class and builds the move masks.
+/// </summary>
+/// <param name=""></param>
+PegBoardEstimator::PegBoardEstimator(void) {
+	NumberOfPlayouts = 1000000;
+	NumberOfThreads = 0;
+	duration = 0;
+	ClearTotals(&totals);
+	BuildMoveMasks(&Geometry::Standard());
+}
+
+/// <summary>
+/// PegBoardEstimator::BuildMoveMasks() copies the geometry's move masks, so a playout never has to unpack the board or follow a pointer.
+/// </summary>
+/// <param name="geometry">Geometry of the board to estimate</param>
+void PegBoardEstimator::BuildMoveMasks(const Geometry *geometry) {
+	numberOfMoves = geometry->GetNumberOfMoves();
+	for (int i = 0; i < numberOfMoves; i++) {
+		fromJumpMask[i] = geometry->GetFromJumpMasks()[i];
+		toMask[i] = geometry->GetToMasks()[i];
+	}
+}
+
+/// <summary>
+/// PegBoardEstimator::EstimateUtil() is the utility function that runs the estimate for the specified PegBoard and displays the estimates with their 95% confidence intervals.
+/// </summary>
+/// <param name="parent"></param>
+void PegBoardEstimator::EstimateUtil(PegBoard parent) {
+	Estimate(parent);
+
+	double games = Mean(totals.games);
+	double solutions = Mean(totals.solutions);
+	double rate = (games > 0) ? solutions / games : 0;
+
+	// Delta-method interval for the ratio of the two means
+	double n = (double)totals.numPlayouts;
+	double rateHalfWidth = 0;
+	if (n > 1 && games > 0) {
+		double varS = (totals.solutions.sumSquares - n * solutions * solutions) / (n - 1);
+		double varG = (totals.games.sumSquares - n * games * games) / (n - 1);
+		double covSG = (totals.sumGamesTimesSolutions - n * solutions * games) / (n - 1);
+		double varRate = (varS - 2 * rate * covSG + rate * rate * varG) / (n * games * games);
+		rateHalfWidth = (varRate > 0) ? CONFIDENCE_Z * std::sqrt(varRate) : 0;
+	}
+
+	std::cout << "Number of Playouts: " << totals.numPlayouts << "\n";
+	std::cout << "Estimated Number of Solutions: " << solutions << " +/- " << HalfWidth(totals.solutions) << "\n";
+	std::cout << "Estimated Number of Games : " << games << " +/- " << HalfWidth(totals.games) << "\n";
+	std::cout << "Estimated Solution Rate: " << rate << " +/- " << rateHalfWidth << "\n";
+	for (int d = 0; d <= ESTIMATOR_MAX_DEPTH; d++) {
+		if (totals.nodesAtDepth[d].sum == 0)
+			break;
+		std::cout << "Estimated Nodes at Depth " << d << ": " << Mean(totals.nodesAtDepth[d]) << " +/- " << HalfWidth(totals.nodesAtDepth[d]) << "\n";
+	}
+	std::cout << "Playouts per Second: " << ((duration > 0) ? (double)totals.numPlayouts / duration : 0) << "\n";
+	std::cout << "\n";
+}
+
+/// <summary>
+/// PegBoardEstimator::Estimate() runs NumberOfPlayouts random playouts from the specified PegBoard, split evenly over NumberOfThreads threads,
+/// and merges the per-thread totals.  Each thread has its own random number generator and totals, so the threads never share memory while running.
+/// </summary>
+/// <param name="parent"></param>
+void PegBoardEstimator::Estimate(PegBoard parent) {
+	int threads = NumberOfThreads;
+	if (threads <= 0)
+		threads = (int)std::thread::hardware_concurrency();
+	if (threads <= 0)
+		threads = 1;
+
+	std::vector <EstimatorTotals> results(threads);
+	std::vector <std::thread> workers;
+	typeBoardKey start = parent.GetKey();
+	BuildMoveMasks(parent.GetGeometry());
+	std::chrono::steady_clock::time_point c_start = std::chrono::steady_clock::now();
+
+	for (int t = 0; t < threads; t++) {
+		long long n = NumberOfPlayouts / threads + ((t < NumberOfPlayouts % threads) ? 1 : 0);
+		unsigned long long seed = Seed + (unsigned long long)(t + 1) * 0xBF58476D1CE4E5B9ULL;
+		workers.push_back(std::thread(&PegBoardEstimator::Playouts, this, start, n, seed, &results[t]));
+	}
+
+	ClearTotals(&totals);
+	for (int t = 0; t < threads; t++) {
+		workers[t].join();
+		AddTotals(&totals, &results[t]);
+	}
+	duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - c_start).count();
+}
+
+/// <summary>
+/// PegBoardEstimator::Playouts() performs n random descents from the starting board.  This is the inner loop of the estimator and works on the packed board only.
+/// The random number generator is xorshift64*, seeded per thread.
+/// </summary>
+/// <param name="start">Starting board</param>
+/// <param name="n">Number of playouts</param>
+/// <param name="seed">Seed for this thread's random number generator</param>
+/// <param name="result">Receives this thread's totals</param>
+void PegBoardEstimator::Playouts(typeBoardKey start, long long n, unsigned long long seed, EstimatorTotals *result) {
+	int available[MAX_NUMBER_OF_MOVES];
+	unsigned long long state = seed ? seed : 1;
+	EstimatorTotals local;	// accumulate locally so threads do not write to neighbouring results while running
+
+	ClearTotals(&local);
+	for (long long p = 0; p < n; p++) {
+		typeBoardKey key = start;
+		double weight = 1;
+		int depth = 0;
+
+		local.nodesAtDepth[0].sum += 1;
+		local.nodesAtDepth[0].sumSquares += 1;
+		for (;;) {
+			int count = 0;
+			for (int i = 0; i < numberOfMoves; i++) {
+				if ((key & fromJumpMask[i]) == fromJumpMask[i] && (key & toMask[i]) == 0)
+					available[count++] = i;
+			}
+			if (count == 0)
+				break;
+
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			unsigned int r = (unsigned int)((state * 0x2545F4914F6CDD1DULL) >> 32);
+			int m = available[((unsigned long long)r * (unsigned int)count) >> 32];
+
+			key ^= fromJumpMask[m] | toMask[m];
+			weight *= count;
+			depth++;
+			local.nodesAtDepth[depth].sum += weight;
+			local.nodesAtDepth[depth].sumSquares += weight * weight;
+		}
+
+		// The playout ended in a game; it is a solution if exactly one peg remains
+		double solved = (key != 0 && (key & (key - 1)) == 0) ? weight : 0;
+		local.games.sum += weight;
+		local.games.sumSquares += weight * weight;
+		local.solutions.sum += solved;
+		local.solutions.sumSquares += solved * solved;
+		local.sumGamesTimesSolutions += weight * solved;
+	}
+	local.numPlayouts = n;
+	*result = local;
+}
+
+/// <summary>
+/// PegBoardEstimator::ClearTotals() zeroes a set of totals.
+/// </summary>
+/// <param name="t">Totals to clear</param>
+void PegBoardEstimator::ClearTotals(EstimatorTotals *t) {
+	t->numPlayouts = 0;
+	t->games.sum = t->games.sumSquares = 0;
+	t->solutions.sum = t->solutions.sumSquares = 0;
+	t->sumGamesTimesSolutions = 0;
+	for (int d = 0; d <= ESTIMATOR_MAX_DEPTH; d++)
+		t->nodesAtDepth[d].sum = t->nodesAtDepth[d].sumSquares = 0;
+}
+
+/// <summary>
+/// PegBoardEstimator::AddTotals() merges the totals of one thread into another set of totals.
+/// </summary>
+/// <param name="dst">Totals to add to</param>
+/// <param name="src">Totals to add</param>
+void PegBoardEstimator::AddTotals(EstimatorTotals *dst, const EstimatorTotals *src) {
+	dst->numPlayouts += src->numPlayouts;
+	dst->games.sum += src->games.sum;
+	dst->games.sumSquares += src->games.sumSquares;
+	dst->solutions.sum += src->solutions.sum;
+	dst->solutions.sumSquares += src->solutions.sumSquares;
+	dst->sumGamesTimesSolutions += src->sumGamesTimesSolutions;
+	for (int d = 0; d <= ESTIMATOR_MAX_DEPTH; d++) {
+		dst->nodesAtDepth[d].sum += src->nodesAtDepth[d].sum;
+		dst->nodesAtDepth[d].sumSquares += src->nodesAtDepth[d].sumSquares;
+	}
+}
+
+/// <summary>
+/// PegBoardEstimator::Mean() returns the estimate of a quantity, i.e. its mean over all playouts.
+/// </summary>
+/// <param name="s">Running sums of the quantity</param>
+/// <returns>Estimated value</returns>
+double PegBoardEstimator::Mean(const EstimatorStatistic &s) {
+	return (totals.numPlayouts > 0) ? s.sum / (double)totals.numPlayouts : 0;
+}
+
+/// <summary>
+/// PegBoardEstimator::HalfWidth() returns the half width of the 95% confidence interval of a quantity.
+/// </summary>
+/// <param name="s">Running sums of the quantity</param>
+/// <returns>Half width of the confidence interval</returns>
+double PegBoardEstimator::HalfWidth(const EstimatorStatistic &s) {
+	double n = (double)totals.numPlayouts;
+	if (n < 2)
+		return 0;
+	double mean = s.sum / n;
+	double variance = (s.sumSquares - n * mean * mean) / (n - 1);
+	return (variance > 0) ? CONFIDENCE_Z * std::sqrt(variance / n) : 0;
+}
+
+/// <summary>
+/// PegBoardEstimator::GetEstimatedGames() returns the estimated number of games of the last estimate.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+double PegBoardEstimator::GetEstimatedGames(void) {
+	return Mean(totals.games);
+}
+
+/// <summary>
+/// PegBoardEstimator::GetEstimatedSolutions() returns the estimated number of solutions of the last estimate.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+double PegBoardEstimator::GetEstimatedSolutions(void) {
+	return Mean(totals.solutions);
+}
+
+/// <summary>
+/// PegBoardEstimator::GetEstimatedNodesAtDepth() returns the estimated number of nodes at the specified depth of the last estimate.
+/// </summary>
+/// <param name="depth">Number of moves played from the starting board</param>
+/// <returns></returns>
+double PegBoardEstimator::GetEstimatedNodesAtDepth(int depth) {
+	if (depth < 0 || depth > ESTIMATOR_MAX_DEPTH)
+		return 0;
+	return Mean(totals.nodesAtDepth[depth]);
+}
@@ -0,0 +1,68 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include "PegBoard.h"
+
+#define ESTIMATOR_MAX_DEPTH MAX_NUMBER_OF_PEGS	// a game cannot last more moves than there are pegs
+
+// Running sums used to compute the mean and confidence interval of one estimated quantity
+struct EstimatorStatistic {
+	double sum;
+	double sumSquares;
+};
+
+// Counters accumulated by one thread of playouts
+struct EstimatorTotals {
+	long long numPlayouts;
+	EstimatorStatistic games;
+	EstimatorStatistic solutions;
+	double sumGamesTimesSolutions;	// needed for the confidence interval of the solution rate
+	EstimatorStatistic nodesAtDepth[ESTIMATOR_MAX_DEPTH + 1];
+};
+
+// PegBoardEstimator estimates the size of the game tree with Knuth's estimator: each playout is a random descent from the starting board,
+// and the product of the branching factors seen along the way is an unbiased estimate of the number of nodes at each depth.
+// A playout that ends in a game adds that product to the number of games (and to the number of solutions if the game is won).
+class PegBoardEstimator
+{
+private:
+	typeBoardKey fromJumpMask[MAX_NUMBER_OF_MOVES];	// pegs that must be Full for move i
+	typeBoardKey toMask[MAX_NUMBER_OF_MOVES];	// hole that must be Empty for move i
+	int numberOfMoves = 0;	// moves of the geometry being estimated
+	EstimatorTotals totals;	// merged over all threads
+	double duration = 0;	// wall-clock seconds taken by the last estimate
+
+	void BuildMoveMasks(const Geometry *geometry);
+	void Playouts(typeBoardKey start, long long n, unsigned long long seed, EstimatorTotals *result);
+	static void ClearTotals(EstimatorTotals *t);
+	static void AddTotals(EstimatorTotals *dst, const EstimatorTotals *src);
+	double Mean(const EstimatorStatistic &s);
+	double HalfWidth(const EstimatorStatistic &s);
+
+public:
+	long long NumberOfPlayouts = 1000000;	// Number of random playouts per estimate
+	int NumberOfThreads = 0;	// Number of threads (0 = one per hardware thread)
+	unsigned long long Seed = 0x9E3779B97F4A7C15ULL;	// Seed for the per-thread random number generators
+
+	PegBoardEstimator(void);
+	void EstimateUtil(PegBoard p);
+	void Estimate(PegBoard p);
+
+	double GetEstimatedGames(void);
+	double GetEstimatedSolutions(void);
+	double GetEstimatedNodesAtDepth(int depth);
+};
@@ -0,0 +1,362 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <iostream>
+#include <bit>
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+#include "PegBoardShardedSolver.h"
+#include "PegBoardSolver.h"
+#include "PegBoard.h"
+
+#ifndef _WIN32
+/// <summary>
+/// WriteAll() writes the whole buffer to a pipe, retrying on short writes and interrupts.
+/// </summary>
+/// <returns>Returns true if every byte was written</returns>
+static bool WriteAll(int fd, const void *buf, size_t len) {
+	const char *p = (const char *)buf;
+	while (len > 0) {
+		ssize_t n = write(fd, p, len);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		len -= (size_t)n;
+	}
+	return true;
+}
+
+/// <summary>
+/// ReadAll() fills the whole buffer from a pipe, retrying on short reads and interrupts.
+/// </summary>
+/// <returns>Returns true if the buffer was filled, false on end-of-file or error</returns>
+static bool ReadAll(int fd, void *buf, size_t len) {
+	char *p = (char *)buf;
+	while (len > 0) {
+		ssize_t n = read(fd, p, len);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		len -= (size_t)n;
+	}
+	return true;
+}
+#endif
+
+/// <summary>
+/// Constructor.  Explicitly initializes the class.
+/// </summary>
+/// <param name=""></param>
+PegBoardShardedSolver::PegBoardShardedSolver(void) {
+	numSolution = 0;
+	numNoSolution = 0;
+	numFrontier = 0;
+	NumberOfWorkers = 4;
+	FrontierDepth = 4;
+	ShardMode = ShardByHash;
+}
+
+/// <summary>
+/// PegBoardShardedSolver::DFS_AllSolutionsShardedUtil() is the utility function that solves the specified PegBoard across worker processes and displays the merged statistics.
+/// </summary>
+/// <param name="parent"></param>
+void PegBoardShardedSolver::DFS_AllSolutionsShardedUtil(PegBoard parent) {
+	DFS_AllSolutionsSharded(parent);
+
+	std::cout << "Number of Workers: " << NumberOfWorkers << "\n";
+	std::cout << "Number of Frontier States: " << numFrontier << "\n";
+	for (size_t w = 0; w < workerResults.size(); w++) {
+		std::cout << "  Worker " << w << ": " << workerResults[w].numStates << " states, "
+			<< workerResults[w].numSolution << " solutions, "
+			<< workerResults[w].numNoSolution << " no solutions\n";
+	}
+	std::cout << "Number of Solutions: " << numSolution << "\n";
+	std::cout << "Number of No Solutions: " << numNoSolution << "\n";
+	std::cout << "Number of Games : " << numSolution + numNoSolution << "\n";
+	std::cout << "\n";
+}
+
+/// <summary>
+/// PegBoardShardedSolver::DFS_AllSolutionsSharded() is the coordinator.  It plays the first FrontierDepth moves itself, splits the resulting boards into one shard per worker,
+/// and merges the counters returned by the workers.  The counters are identical to those of PegBoardSolver::DFS_AllSolutions().
+/// </summary>
+/// <param name="parent"></param>
+void PegBoardShardedSolver::DFS_AllSolutionsSharded(PegBoard parent) {
+	ArenaScope scope(&arena, true);
+	typeFrontier frontier;
+	std::vector <typeShard> shards;
+	int workers = (NumberOfWorkers < 1) ? 1 : NumberOfWorkers;
+
+	numSolution = 0;
+	numNoSolution = 0;
+	workerResults.clear();
+	geometry = parent.GetGeometry();
+
+	ExpandFrontier(parent, &frontier);
+	numFrontier = (long long)frontier.size();
+
+	shards.resize(workers);
+	int index = 0;
+	for (typeFrontier::iterator it = frontier.begin(); it != frontier.end(); it++, index++) {
+		FrontierState state = { it->first, it->second };
+		shards[ShardOf(it->first, index, (int)frontier.size())].push_back(state);
+	}
+
+	RunShards(&shards);
+
+	for (size_t w = 0; w < workerResults.size(); w++) {
+		numSolution += workerResults[w].numSolution;
+		numNoSolution += workerResults[w].numNoSolution;
+	}
+}
+
+/// <summary>
+/// PegBoardShardedSolver::ExpandFrontier() plays FrontierDepth moves breadth first from the starting board.
+/// Boards reached by several move sequences are merged and carry the number of sequences reaching them, so each one is solved only once.
+/// Games that end before FrontierDepth are counted here rather than by a worker.
+/// Each layer is expanded BITSLICE_BOARDS boards at a time with BitSlicedBoards.
+/// </summary>
+/// <param name="start">Starting board</param>
+/// <param name="frontier">Receives the boards (and their multiplicity) that are left to the workers</param>
+void PegBoardShardedSolver::ExpandFrontier(PegBoard start, typeFrontier *frontier) {
+	typeFrontier layer, next;
+	BitSlicedBoards batch(geometry);
+	typeBoardKey keys[BITSLICE_BOARDS];
+	long long counts[BITSLICE_BOARDS];
+
+	layer[start.GetKey()] = 1;
+	for (int depth = 0; depth < FrontierDepth && layer.size() > 0; depth++) {
+		next.clear();
+		typeFrontier::iterator it = layer.begin();
+		while (it != layer.end()) {
+			int n = 0;
+			for (; it != layer.end() && n < BITSLICE_BOARDS; it++, n++) {
+				keys[n] = it->first;
+				counts[n] = it->second;
+			}
+			batch.Load(keys, n);
+			ExpandBatch(&batch, keys, counts, &next);
+		}
+		layer.swap(next);
+	}
+	frontier->swap(layer);
+}
+
+/// <summary>
+/// PegBoardShardedSolver::ExpandBatch() expands one batch of a layer.  Solved and stuck boards end their games here; every legal move of the
+/// other boards adds a child to the next layer.  A child is its parent's key with the move's holes flipped, so the batch is never transposed back.
+/// </summary>
+/// <param name="batch">Batch loaded with keys</param>
+/// <param name="keys">Packed boards of the batch</param>
+/// <param name="counts">Multiplicity of each board</param>
+/// <param name="next">Next layer</param>
+void PegBoardShardedSolver::ExpandBatch(BitSlicedBoards *batch, const typeBoardKey *keys, const long long *counts, typeFrontier *next) {
+	typeBoardMask solved, legal, any;
+
+	batch->Solved(solved);
+	for (int w = 0; w < BITSLICE_WORDS; w++)
+		any[w] = 0;
+
+	for (int m = 0; m < batch->GetNumberOfMoves(); m++) {
+		batch->LegalMoves(m, legal);
+		typeBoardKey flip = batch->GetMoveMask(m);
+		for (int w = 0; w < BITSLICE_WORDS; w++) {
+			any[w] |= legal[w];
+			for (unsigned long long bits = legal[w]; bits != 0; bits &= bits - 1) {
+				int b = 64 * w + std::countr_zero(bits);
+				(*next)[keys[b] ^ flip] += counts[b];
+			}
+		}
+	}
+
+	for (int b = 0; b < batch->GetNumberOfBoards(); b++) {
+		unsigned long long bit = 1ULL << (b % 64);
+		if (solved[b / 64] & bit)
+			numSolution += counts[b];
+		else if (!(any[b / 64] & bit))
+			numNoSolution += counts[b];
+	}
+}
+
+/// <summary>
+/// PegBoardShardedSolver::ShardOf() selects the worker for a frontier board.
+/// ShardByHash spreads boards by a hash of their key; ShardByRange gives each worker a contiguous range of the (sorted) frontier.
+/// </summary>
+/// <param name="key">Board to assign</param>
+/// <param name="index">Position of the board in the frontier</param>
+/// <param name="size">Number of boards in the frontier</param>
+/// <returns>Worker index</returns>
+int PegBoardShardedSolver::ShardOf(typeBoardKey key, int index, int size) {
+	int workers = (NumberOfWorkers < 1) ? 1 : NumberOfWorkers;
+	if (ShardMode == ShardByRange)
+		return (int)(((long long)index * workers) / size);
+
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	return (int)(key % (typeBoardKey)workers);
+}
+
+/// <summary>
+/// PegBoardShardedSolver::SolveShard() is the worker.  It solves every board in its shard with PegBoardSolver::DFS_AllSolutions() and scales the counters by the board's multiplicity.
+/// </summary>
+/// <param name="geometry">Geometry of the boards</param>
+/// <param name="states">Boards to solve</param>
+/// <param name="n">Number of boards</param>
+/// <param name="result">Receives the worker's counters</param>
+void PegBoardShardedSolver::SolveShard(const Geometry *geometry, const FrontierState *states, size_t n, ShardResult *result) {
+	PegBoardSolver solver;
+	PegBoard board;
+
+	board.SetGeometry(geometry);
+
+	solver.ShowSolutions = false;
+	result->numSolution = 0;
+	result->numNoSolution = 0;
+	result->numStates = (long long)n;
+	for (size_t i = 0; i < n; i++) {
+		board.SetKey(states[i].key);
+		solver.ResetStatistics();
+		solver.DFS_AllSolutions(board);
+		result->numSolution += states[i].count * solver.GetNumberOfSolutions();
+		result->numNoSolution += states[i].count * solver.GetNumberOfNoSolutions();
+	}
+}
+
+/// <summary>
+/// PegBoardShardedSolver::RunShards() forks one worker process per shard.  Each worker receives its shard over a pipe in batches of SHARD_BATCH_SIZE boards
+/// and answers with a single ShardResult over a second pipe.  On Windows (no fork()) the shards are solved one after another in this process.
+/// A worker that cannot be started, dies, or does not report its counters has its shard solved again in this process, so the totals are always complete.
+/// </summary>
+/// <param name="shards">One shard per worker</param>
+void PegBoardShardedSolver::RunShards(std::vector <typeShard> *shards) {
+	size_t workers = shards->size();
+	workerResults.assign(workers, ShardResult());
+
+#ifdef _WIN32
+	for (size_t w = 0; w < workers; w++)
+		SolveShard(geometry, (*shards)[w].data(), (*shards)[w].size(), &workerResults[w]);
+#else
+	std::vector <pid_t> pids(workers, -1);
+	std::vector <int> toWorker(workers, -1), fromWorker(workers, -1);
+
+	// A worker that died closes its end of the pipe; writing to it must fail with EPIPE rather than kill the coordinator
+	void (*oldHandler)(int) = signal(SIGPIPE, SIG_IGN);
+
+	for (size_t w = 0; w < workers; w++) {
+		int down[2], up[2];
+		if (pipe(down) != 0)
+			break;
+		if (pipe(up) != 0) {
+			close(down[0]);
+			close(down[1]);
+			break;
+		}
+
+		pid_t pid = fork();
+		if (pid == 0) {
+			// Worker: drop the coordinator's ends of every pipe, read the shard until end-of-file, solve it, and report back
+			for (size_t i = 0; i < w; i++) {
+				close(toWorker[i]);
+				close(fromWorker[i]);
+			}
+			close(down[1]);
+			close(up[0]);
+
+			typeShard shard;
+			unsigned int n;
+			while (ReadAll(down[0], &n, sizeof(n))) {
+				size_t old = shard.size();
+				shard.resize(old + n);
+				if (!ReadAll(down[0], shard.data() + old, n * sizeof(FrontierState)))
+					_exit(1);
+			}
+			ShardResult result;
+			SolveShard(geometry, shard.data(), shard.size(), &result);
+			_exit(WriteAll(up[1], &result, sizeof(result)) ? 0 : 1);
+		}
+
+		close(down[0]);
+		close(up[1]);
+		if (pid < 0) {
+			close(down[1]);
+			close(up[0]);
+			break;
+		}
+		pids[w] = pid;
+		toWorker[w] = down[1];
+		fromWorker[w] = up[0];
+	}
+
+	// Coordinator: hand out the shards in batches, then collect the counters
+	for (size_t w = 0; w < workers; w++) {
+		if (pids[w] < 0)
+			continue;
+		const typeShard &shard = (*shards)[w];
+		for (size_t i = 0; i < shard.size(); i += SHARD_BATCH_SIZE) {
+			unsigned int n = (unsigned int)((shard.size() - i < SHARD_BATCH_SIZE) ? shard.size() - i : SHARD_BATCH_SIZE);
+			if (!WriteAll(toWorker[w], &n, sizeof(n)) || !WriteAll(toWorker[w], &shard[i], n * sizeof(FrontierState)))
+				break;
+		}
+		close(toWorker[w]);
+	}
+	for (size_t w = 0; w < workers; w++) {
+		bool reported = false;
+		if (pids[w] >= 0) {
+			int status = 0;
+			reported = ReadAll(fromWorker[w], &workerResults[w], sizeof(ShardResult));
+			close(fromWorker[w]);
+			while (waitpid(pids[w], &status, 0) < 0 && errno == EINTR)
+				;
+			reported = reported && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+			if (!reported)
+				std::cerr << "Worker " << w << " failed to report its results; solving its shard here\n";
+		}
+		if (!reported) {
+			// the worker could not be started or failed; solve its shard here so the totals stay correct
+			SolveShard(geometry, (*shards)[w].data(), (*shards)[w].size(), &workerResults[w]);
+		}
+	}
+	signal(SIGPIPE, oldHandler);
+#endif
+}
+
+/// <summary>
+/// PegBoardShardedSolver::GetNumberOfSolutions() returns the merged number of solutions of the last search.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Number of solutions</returns>
+long long PegBoardShardedSolver::GetNumberOfSolutions(void) {
+	return numSolution;
+}
+
+/// <summary>
+/// PegBoardShardedSolver::GetNumberOfNoSolutions() returns the merged number of dead-end games of the last search.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Number of games that did not end in a solution</returns>
+long long PegBoardShardedSolver::GetNumberOfNoSolutions(void) {
+	return numNoSolution;
+}
@@ -0,0 +1,72 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include <map>
+#include <vector>
+#include "PegBoard.h"
+#include "SearchArena.h"
+#include "BitSlicedBoards.h"
+
+#define SHARD_BATCH_SIZE 256	// number of frontier states sent to a worker per write
+
+// How frontier states are assigned to workers
+enum SHARDMODE { ShardByHash = 0, ShardByRange = 1 };
+
+// A board on the frontier, and how many distinct move sequences reach it
+struct FrontierState {
+	typeBoardKey key;
+	long long count;
+};
+
+// Counters returned by a worker when it has solved its shard
+struct ShardResult {
+	long long numSolution;
+	long long numNoSolution;
+	long long numStates;
+};
+
+typedef std::map <typeBoardKey, long long, std::less <typeBoardKey>, ArenaAllocator <std::pair <const typeBoardKey, long long> > > typeFrontier;
+typedef std::vector <FrontierState> typeShard;
+
+class PegBoardShardedSolver
+{
+private:
+	long long numSolution = 0;	// Number of games that ended in a solution (merged over all workers)
+	long long numNoSolution = 0;	// Number of games that did not end in a solution (merged over all workers)
+	long long numFrontier = 0;	// Number of distinct boards handed out to workers
+	std::vector <ShardResult> workerResults;	// counters reported by each worker
+	SearchArena arena;	// node pool for the coordinator's frontier expansion
+	const Geometry *geometry = &Geometry::Standard();	// geometry of the board being solved
+
+	void ExpandFrontier(PegBoard start, typeFrontier *frontier);
+	void ExpandBatch(BitSlicedBoards *batch, const typeBoardKey *keys, const long long *counts, typeFrontier *next);
+	int ShardOf(typeBoardKey key, int index, int size);
+	void RunShards(std::vector <typeShard> *shards);
+	static void SolveShard(const Geometry *geometry, const FrontierState *states, size_t n, ShardResult *result);
+
+public:
+	int NumberOfWorkers = 4;	// Number of worker processes
+	int FrontierDepth = 4;	// Number of moves the coordinator plays before handing boards to the workers
+	SHARDMODE ShardMode = ShardByHash;	// How frontier boards are assigned to workers
+
+	PegBoardShardedSolver(void);
+	void DFS_AllSolutionsShardedUtil(PegBoard p);
+	void DFS_AllSolutionsSharded(PegBoard p);
+
+	long long GetNumberOfSolutions(void);
+	long long GetNumberOfNoSolutions(void);
+};
@@ -15,6 +15,7 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <iostream>
+#include <bit>
 #include "PegBoardSolver.h"
 #include "PegBoard.h"
 
@@ -28,36 +29,44 @@ PegBoardSolver::PegBoardSolver(void) {
 	numSeenBefore = 0;	
 	StopWithSolution = false; // Do we stop on the first solution?
 	ShowSolutions = true; // Do we show the solutions as they are found?
-	listUnSolvable.clear();
+	KeepSolutions = false; // Do we keep the solutions for future use?
+	cacheUnSolvable.Clear();
 }
 
 /// <summary>
 /// PegBoardSolver::DFS_AllSolutionsUtil() is the utility function that solves the specified PegBoard and displays the statistics.
-/// Future work: keep the solutions in a list for future use.
+/// If KeepSolutions == true, solutions are kept as PackedPaths (see GetSolutions()).
 /// </summary>
 /// <param name="parent"></param>
 void PegBoardSolver::DFS_AllSolutionsUtil(PegBoard parent) {
 	numSolution = 0;
 	numNoSolution = 0;
+	solutions.clear();
 	
 	DFS_AllSolutions(parent);
 	std::cout << "Number of Solutions: " << numSolution << "\n";
 	std::cout << "Number of No Solutions: " << numNoSolution << "\n";
 	std::cout << "Number of Games : " << numSolution + numNoSolution << "\n";
+	arena.ShowStatistics();
 	std::cout << "\n";
 }
 
 /// <summary>
-/// PegBoardSolver::DFS_AllSolutions() solves the specified PegBoard and keeps track of statistics.  This function does not keep track of unsolvable configurations (listUnSolvable).
+/// PegBoardSolver::DFS_AllSolutions() solves the specified PegBoard and keeps track of statistics.  This function does not keep track of unsolvable configurations (cacheUnSolvable).
 /// If ShowSolutions == true, solutions are displayed as they are found.
 /// If StopWithSolution == true, find only one solution.
-/// Future work: keep the solutions in a list for future use.
+/// If KeepSolutions == true, solutions are kept as PackedPaths (see GetSolutions()).
 /// </summary>
 /// <param name="parent"></param>
 void PegBoardSolver::DFS_AllSolutions(PegBoard parent) {
+	ArenaScope scope(&arena, true);	// the outermost call resets the arena; recursive calls find it already current
+	geometry = parent.GetGeometry();
+
 	// Is the board in a a valid ending (winning) configuration? If so, it has been solved
 	if (parent.isSolved()) {
 		numSolution++;
+		if (KeepSolutions)
+			solutions.push_back(parent.GetPath());
 		if (ShowSolutions) {
 			// Display the solution that was found
 			std::cout << "[" << numSolution << "] ";
@@ -96,38 +105,214 @@ void PegBoardSolver::DFS_AllSolutions(PegBoard parent) {
 
 /// <summary>
 /// PegBoardSolver::DFS_AllSolutionsWithLookUpUtil() is the utility function that solves the specified PegBoard and displays the statistics.
-/// Future work: keep the solutions in a list for future use.
+/// If KeepSolutions == true, solutions are kept as PackedPaths (see GetSolutions()).
 /// </summary>
 /// <param name="parent"></param>
 void PegBoardSolver::DFS_AllSolutionsWithLookUpUtil(PegBoard *parent) {
 	numSolution = 0;
 	numNoSolution = 0;
 	numSeenBefore = 0;
-	listUnSolvable.clear();
+	numSeenFromOtherVacancy = 0;
+	currentVacancy = parent->GetBoard().GetStartingVacancy();
+	solutions.clear();
+	ClearUnsolvableList();
+	cacheGeometry = parent->GetGeometry();
+	ArenaScope scope(&arena, true);
 
 	DFS_AllSolutionsWithLookUp(parent);
+	ShowLookUpStatistics();
+	cacheUnSolvable.ShowStatistics();
+	arena.ShowStatistics();
+
+	std::cout << "\n";
+}
+
+/// <summary>
+/// PegBoardSolver::DFS_AllVacanciesWithLookUpUtil() solves every starting vacancy in a single pass and displays the statistics of each.
+/// Unlike calling DFS_AllSolutionsWithLookUpUtil() once per vacancy, cacheUnSolvable is shared between the vacancies: whether a board can be solved
+/// does not depend on how it was reached, so a board found unsolvable while solving one vacancy is never solved again for another.
+/// The statistics also report how many of the look ups were answered by boards found while solving a different vacancy.
+/// The number of solutions of each vacancy is exact, since only unsolvable boards are cached.  The number of games is not the number of games of that
+/// vacancy: a board already in the cache is counted as a single game, so it depends on which vacancies were solved before.  It is reported as the number
+/// of games searched to tell it apart from the figures of DFS_AllSolutionsWithLookUpUtil().
+/// </summary>
+/// <param name="parent">PegBoard used for every vacancy; it is initialized for each in turn</param>
+void PegBoardSolver::DFS_AllVacanciesWithLookUpUtil(PegBoard *parent) {
+	long long totalSeenBefore = 0;
+	long long totalSeenFromOtherVacancy = 0;
+
+	solutions.clear();
+	ClearUnsolvableList();
+	cacheGeometry = parent->GetGeometry();
+	ArenaScope scope(&arena, true);
+
+	for (int iEmpty = 0; iEmpty < parent->GetGeometry()->GetNumberOfHoles(); iEmpty++) {
+		numSolution = 0;
+		numNoSolution = 0;
+		numSeenBefore = 0;
+		numSeenFromOtherVacancy = 0;
+		currentVacancy = iEmpty;
+		parent->Initialize(iEmpty);
+
+		DFS_AllSolutionsWithLookUp(parent);
+		std::cout << "Starting Vacancy: " << iEmpty << "\n";
+		std::cout << "Number of Solutions: " << numSolution << "\n";
+		std::cout << "Number of Dead Ends Searched: " << numNoSolution << "\n";
+		std::cout << "Number of Seen Before as No Solutions: " << numSeenBefore << "\n";
+		std::cout << "Number of Seen Before from Other Vacancies: " << numSeenFromOtherVacancy << "\n";
+		std::cout << "Size of Unsolvable List: " << cacheUnSolvable.GetSize() << "\n";
+		std::cout << "Number of Games Searched (depends on the vacancies solved before): " << numSolution + numNoSolution << "\n";
+		std::cout << "\n";
+
+		totalSeenBefore += numSeenBefore;
+		totalSeenFromOtherVacancy += numSeenFromOtherVacancy;
+	}
+
+	std::cout << "All Vacancies -- Seen Before as No Solutions: " << totalSeenBefore << "\n";
+	std::cout << "All Vacancies -- Seen Before from Other Vacancies: " << totalSeenFromOtherVacancy << "\n";
+	std::cout << "All Vacancies -- Size of Unsolvable List: " << cacheUnSolvable.GetSize() << "\n";
+	cacheUnSolvable.ShowStatistics();
+	arena.ShowStatistics();
+	std::cout << "\n";
+}
+
+/// <summary>
+/// PegBoardSolver::Solutions() lazily generates the solutions of the specified PegBoard, one at a time and in the same order as DFS_AllSolutions().
+/// The search is suspended between solutions, so the caller can stop after the first few (or filter them) without StopWithSolution or StopFindingSolutions,
+/// and a UI can pull solutions as it needs them.  The search keeps an explicit stack of boards and their untried moves instead of recursing.
+/// The solver must outlive the Generator; its statistics are not updated.
+/// </summary>
+/// <param name="root">PegBoard to be solved</param>
+/// <returns>Generator yielding each solution as a PackedPath</returns>
+Generator <PackedPath> PegBoardSolver::Solutions(PegBoard root) {
+	struct Frame {
+		PegBoard board;
+		typeListOfMoves moves;	// moves of board that have not been tried yet
+	};
+	std::vector <Frame> stack;
+	PackedPath solution;
+	bool found;
+
+	if (root.isSolved()) {
+		co_yield root.GetPath();
+		co_return;
+	}
+
+	stack.reserve(root.GetGeometry()->GetNumberOfHoles());
+	{
+		ArenaScope scope(&arena, false);
+		Frame frame = { root, root.GetAvailableMoves() };
+		stack.push_back(frame);
+	}
+
+	while (stack.size() > 0) {
+		// Advance the search to the next solution.  The arena is only current while the search runs, never while the coroutine is suspended.
+		found = false;
+		{
+			ArenaScope scope(&arena, false);
+			while (!found && stack.size() > 0) {
+				Frame &top = stack.back();
+				if (top.moves.size() == 0) {
+					stack.pop_back();
+					continue;
+				}
+
+				Move m = top.moves.front(); // next move to attempt
+				top.moves.pop_front();
+				PegBoard child;
+				child.CopyBoard(top.board);
+				child.PerformMove(m);
+				child.AddToPath(m);
+
+				if (child.isSolved()) {
+					solution = child.GetPath();
+					found = true;
+				}
+				else {
+					Frame frame = { child, child.GetAvailableMoves() };
+					if (frame.moves.size() > 0)
+						stack.push_back(frame);
+				}
+			}
+		}
+		if (found)
+			co_yield solution;
+	}
+}
+
+/// <summary>
+/// PegBoardSolver::IsSolvable() determines if the specified PegBoard can be reduced to a single peg, without counting or keeping solutions.
+/// The answer comes from the geometry's solvability table when it has one (Geometry::Standard() always does), so no search is needed;
+/// otherwise a depth-first search stops at the first solution and keeps the boards found to be unsolvable in the look up table.
+/// The table is kept between queries on the same geometry and emptied when the geometry changes.
+/// </summary>
+/// <param name="parent">PegBoard to query</param>
+/// <returns>Returns true if the board is solvable</returns>
+bool PegBoardSolver::IsSolvable(PegBoard *parent) {
+	if (parent->GetGeometry()->HasSolvabilityTable())
+		return parent->GetGeometry()->IsSolvable(parent->GetKey());
+	SetLookUpGeometry(parent->GetGeometry());
+	return SearchSolvable(parent->GetKey());
+}
+
+/// <summary>
+/// PegBoardSolver::SearchSolvable() is the search behind IsSolvable(): it returns as soon as a move leads to a solvable board.
+/// </summary>
+/// <param name="key">Packed board</param>
+/// <returns>Returns true if the board is solvable</returns>
+bool PegBoardSolver::SearchSolvable(typeBoardKey key) {
+	if (std::popcount(key) == 1)
+		return true;
+
+	Board node;
+	node.SetKey(key);
+	if (IsBoardInUnsolvableList(node))
+		return false;
+
+	const typeBoardKey *fromJump = geometry->GetFromJumpMasks();
+	const typeBoardKey *to = geometry->GetToMasks();
+	const typeBoardKey *flip = geometry->GetMoveMasks();
+	for (int i = 0; i < geometry->GetNumberOfMoves(); i++) {
+		if ((key & fromJump[i]) == fromJump[i] && (key & to[i]) == 0 && SearchSolvable(key ^ flip[i]))
+			return true;
+	}
+	AddToUnsolvableList(node);
+	return false;
+}
+
+/// <summary>
+/// PegBoardSolver::ShowLookUpStatistics() displays the statistics of the last search with the look up table.
+/// </summary>
+/// <param name=""></param>
+void PegBoardSolver::ShowLookUpStatistics(void) {
 	std::cout << "Number of Solutions: " << numSolution << "\n";
 	std::cout << "Number of No Solutions: " << numNoSolution << "\n";
 	std::cout << "Number of Seen Before as No Solutions: " << numSeenBefore << "\n";
-	std::cout << "Size of Unsolvable List: " << listUnSolvable.size() << "\n";
+	std::cout << "Number of Seen Before from Other Vacancies: " << numSeenFromOtherVacancy << "\n";
+	std::cout << "Size of Unsolvable List: " << cacheUnSolvable.GetSize() << "\n";
 	std::cout << "Number of Games : " << numSolution + numNoSolution << "\n";
-
-	std::cout << "\n";
 }
 
 /// <summary>
 /// PegBoardSolver::DFS_AllSolutionsWithLookUp() solves the specified PegBoard and keeps track of statistics.  
-/// This function keeps track of unsolvable configurations (listUnSolvable) and uses this to prevent itself from attempting to solve these types of configurations.
+/// This function keeps track of unsolvable configurations (cacheUnSolvable) and uses this to prevent itself from attempting to solve these types of configurations.
+/// cacheUnSolvable has a fixed memory budget, so a board that was evicted is solved again.  This never changes the number of solutions, only the amount of work
+/// (and the number of games, since a board found in the cache is counted as a single game).
 /// If ShowSolutions == true, solutions are displayed as they are found.
 /// If StopWithSolution == true, find only one solution.
-/// Future work: keep the solutions in a list for future use.
+/// If KeepSolutions == true, solutions are kept as PackedPaths (see GetSolutions()).
 /// </summary>
 /// <param name="parent"></param>
 void PegBoardSolver::DFS_AllSolutionsWithLookUp(PegBoard *parent) {
+	ArenaScope scope(&arena, false);	// the caller's lists may still hold nodes from an earlier call, so never reset here
+	SetLookUpGeometry(parent->GetGeometry());
+
 	// visit current Board first, is it solved?
 	if (parent->isSolved()) {
 		numSolution++;
 		parent->SetBoardSolvable(true);
+		if (KeepSolutions)
+			solutions.push_back(parent->GetPath());
 
 		if (ShowSolutions) {
 			std::cout << "[" << numSolution << "] ";
@@ -162,7 +347,7 @@ void PegBoardSolver::DFS_AllSolutionsWithLookUp(PegBoard *parent) {
 				// add parent to list of unsolveable nodes
 				Board pBoard = parent->GetBoard();
 				
-				listUnSolvable.push_back(pBoard);
+				AddToUnsolvableList(pBoard);
 			}
 			else {
 				while (moves.size() > 0) {
@@ -181,7 +366,7 @@ void PegBoardSolver::DFS_AllSolutionsWithLookUp(PegBoard *parent) {
 				if (!parent->IsBoardSolvable()) {
 					// add parent to list of unsolveable nodes
 					Board pBoard = parent->GetBoard();
-					listUnSolvable.push_back(pBoard);
+					AddToUnsolvableList(pBoard);
 				}
 			}
 		}
@@ -189,20 +374,60 @@ void PegBoardSolver::DFS_AllSolutionsWithLookUp(PegBoard *parent) {
 }
 
 /// <summary>
-/// PegBoardSolver::IsBoardInUnsolvableList() determines if a specified board is in a list of boards that were deemed to be unsolvable.
-/// Future Work: Explore how to speed up the search in this list.  
+/// PegBoardSolver::LookUpKey() returns the key under which a board is kept in the look up table: the packed board, or its canonical form when UseSymmetry == true.
 /// </summary>
-/// <param name="node">Board to be searched in listUnsolvable</param>
-/// <returns>Returns true/false if the specified node is in/not in the list</returns>
+/// <param name="node">Board</param>
+/// <returns>Look up key of the board</returns>
+typeBoardKey PegBoardSolver::LookUpKey(Board node) {
+	if (UseSymmetry)
+		return geometry->Canonical(node.GetKey());
+	return node.GetKey();
+}
+
+/// <summary>
+/// PegBoardSolver::IsBoardInUnsolvableList() determines if a specified board is in the cache of boards that were deemed to be unsolvable.
+/// The cache is hashed on the packed board, so the look up takes constant time.
+/// </summary>
+/// <param name="node">Board to be searched in cacheUnSolvable</param>
+/// <returns>Returns true/false if the specified node is in/not in the cache</returns>
 bool PegBoardSolver::IsBoardInUnsolvableList(Board node) {
+	int vacancy;
 
-	typeListOfBoards::iterator it;
-	for (it = listUnSolvable.begin(); it != listUnSolvable.end(); it++) {
-		if (node.isEqual(*it)) {
-				return true;
-			}
+	if (!cacheUnSolvable.Probe(LookUpKey(node), &vacancy))
+		return false;
+	if (vacancy != currentVacancy)
+		numSeenFromOtherVacancy++;
+	return true;
+}
+
+/// <summary>
+/// PegBoardSolver::AddToUnsolvableList() adds a board to the cache of boards that were deemed to be unsolvable, recording the current starting vacancy.
+/// The cache may keep another board instead, according to its replacement policy.
+/// </summary>
+/// <param name="node">Board to be added</param>
+void PegBoardSolver::AddToUnsolvableList(Board node) {
+	cacheUnSolvable.Store(LookUpKey(node), node.RemainingPegs(), currentVacancy);
+}
+
+/// <summary>
+/// PegBoardSolver::ClearUnsolvableList() empties cacheUnSolvable and resets its counters.
+/// </summary>
+/// <param name=""></param>
+void PegBoardSolver::ClearUnsolvableList(void) {
+	cacheUnSolvable.Clear();
+}
+
+/// <summary>
+/// PegBoardSolver::SetLookUpGeometry() selects the geometry of the board being solved.  A packed board only means something on its own geometry,
+/// so cacheUnSolvable is emptied when it holds boards of another one.
+/// </summary>
+/// <param name="g">Geometry of the board being solved</param>
+void PegBoardSolver::SetLookUpGeometry(const Geometry *g) {
+	geometry = g;
+	if (cacheGeometry != g) {
+		ClearUnsolvableList();
+		cacheGeometry = g;
 	}
-	return false;
 }
 
 /// <summary>
@@ -210,9 +435,92 @@ bool PegBoardSolver::IsBoardInUnsolvableList(Board node) {
 /// </summary>
 /// <param name=""></param>
 void PegBoardSolver::ShowUnsolvableList(void) {
+	cacheUnSolvable.ShowBoards(geometry->GetNumberOfHoles());
+}
+
+/// <summary>
+/// PegBoardSolver::ResetStatistics() clears the solution counters without displaying them.  Used when the solver is driven by another class (e.g. PegBoardShardedSolver).
+/// </summary>
+/// <param name=""></param>
+void PegBoardSolver::ResetStatistics(void) {
+	numSolution = 0;
+	numNoSolution = 0;
+	numSeenBefore = 0;
+}
+
+/// <summary>
+/// PegBoardSolver::GetNumberOfSolutions() returns the number of solutions found since the statistics were last reset.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Number of solutions</returns>
+long long PegBoardSolver::GetNumberOfSolutions(void) {
+	return numSolution;
+}
+
+/// <summary>
+/// PegBoardSolver::GetNumberOfNoSolutions() returns the number of dead-end games found since the statistics were last reset.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Number of games that did not end in a solution</returns>
+long long PegBoardSolver::GetNumberOfNoSolutions(void) {
+	return numNoSolution;
+}
+
+/// <summary>
+/// PegBoardSolver::GetArena() returns the node pool used by the solver, e.g. to read its allocation statistics.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Pointer to the solver's SearchArena</returns>
+SearchArena *PegBoardSolver::GetArena(void) {
+	return &arena;
+}
 
-	typeListOfBoards::iterator it;
-	for (it = listUnSolvable.begin(); it != listUnSolvable.end(); it++) {
-		it->ShowBoard();
+/// <summary>
+/// PegBoardSolver::ShowSolutionList() displays the solutions kept since the last Util call (see KeepSolutions).
+/// The packed moves are decoded with the geometry of the board that was solved.
+/// </summary>
+/// <param name=""></param>
+void PegBoardSolver::ShowSolutionList(void) {
+	PegBoard board;	// used to decode the packed moves
+	board.SetGeometry(geometry);
+	for (size_t i = 0; i < solutions.size(); i++) {
+		std::cout << "[" << i + 1 << "] ";
+		board.ShowPath(solutions[i]);
 	}
 }
+
+/// <summary>
+/// PegBoardSolver::GetSolutions() returns the solutions kept since the last Util call (see KeepSolutions).
+/// </summary>
+/// <param name=""></param>
+/// <returns>Pointer to the list of PackedPaths</returns>
+typeListOfPaths *PegBoardSolver::GetSolutions(void) {
+	return &solutions;
+}
+
+/// <summary>
+/// PegBoardSolver::ClearSolutions() discards the kept solutions.
+/// </summary>
+/// <param name=""></param>
+void PegBoardSolver::ClearSolutions(void) {
+	solutions.clear();
+}
+
+/// <summary>
+/// PegBoardSolver::SetLookUpBudget() sets the memory budget and replacement policy of the cache of unsolvable boards.  The cache is emptied.
+/// </summary>
+/// <param name="bytes">Hard memory budget, in bytes</param>
+/// <param name="policy">DepthPreferred, AlwaysReplace or TwoTier</param>
+/// <returns>Returns false if the budget is smaller than one bucket of the cache; the cache is then left unchanged</returns>
+bool PegBoardSolver::SetLookUpBudget(size_t bytes, CACHEPOLICY policy) {
+	return cacheUnSolvable.SetBudget(bytes, policy);
+}
+
+/// <summary>
+/// PegBoardSolver::GetLookUpCache() returns the cache of unsolvable boards, e.g. to read its counters.
+/// </summary>
+/// <param name=""></param>
+/// <returns>Pointer to cacheUnSolvable</returns>
+LookUpCache *PegBoardSolver::GetLookUpCache(void) {
+	return &cacheUnSolvable;
+}
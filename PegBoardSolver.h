@@ -15,24 +15,43 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
+#include <vector>
 #include "PegBoard.h"
+#include "SearchArena.h"
+#include "Generator.h"
+#include "LookUpCache.h"
 
-typedef std::list <PegBoard> typeListOfPegBoards;
+typedef std::list <PegBoard, ArenaAllocator <PegBoard> > typeListOfPegBoards;
+typedef std::vector <PackedPath> typeListOfPaths;
 
 class PegBoardSolver
 {
 private:
-	int numSolution = 0;	// Number of PegBoards to which a solution was found
-	int numNoSolution = 0;  // Number of PegBoards to which a solution was not found
-	int numSeenBefore = 0;	// Number of PegBoards that had previously been seen
+	long long numSolution = 0;	// Number of PegBoards to which a solution was found
+	long long numNoSolution = 0;  // Number of PegBoards to which a solution was not found
+	long long numSeenBefore = 0;	// Number of PegBoards that had previously been seen
+	long long numSeenFromOtherVacancy = 0;	// Number of PegBoards that had previously been seen while solving a different starting vacancy
+	int currentVacancy = -1;	// Starting vacancy of the board being solved with the look up table
+	const Geometry *geometry = &Geometry::Standard();	// Geometry of the board being solved, set by every search
+	const Geometry *cacheGeometry = NULL;	// Geometry of the boards held by cacheUnSolvable
 	bool StopFindingSolutions = false;	// flag to stop finding solutions
-	typeListOfBoards listUnSolvable;	// list of PegBoards determined to be UnSolvable
+	SearchArena arena;	// node pool for every list created during a search; must be declared before the lists that draw from it
+	LookUpCache cacheUnSolvable;	// PegBoards determined to be UnSolvable, within a fixed memory budget
+	typeListOfPaths solutions;	// solutions found so far, kept when KeepSolutions == true
 
+	typeBoardKey LookUpKey(Board p);
 	bool IsBoardInUnsolvableList(Board p);	
+	void AddToUnsolvableList(Board p);
+	void ClearUnsolvableList(void);
+	void SetLookUpGeometry(const Geometry *g);
+	void ShowLookUpStatistics(void);
+	bool SearchSolvable(typeBoardKey key);
 	
 public:
 	bool StopWithSolution = false;	// Do we stop on the first solution?
 	bool ShowSolutions = true;	// Do we show the solutions as they are found?
+	bool KeepSolutions = false;	// Do we keep the solutions (one PackedPath each) for future use?
+	bool UseSymmetry = false;	// Do we store boards in the look up table by their canonical form, so that a board also answers for its mirror images?
 
 	PegBoardSolver(void);
 	void DFS_AllSolutionsUtil(PegBoard p);
@@ -40,7 +59,21 @@ public:
 
 	void DFS_AllSolutionsWithLookUpUtil(PegBoard *p);
 	void DFS_AllSolutionsWithLookUp(PegBoard *p);
+	void DFS_AllVacanciesWithLookUpUtil(PegBoard *p);
+
+	Generator <PackedPath> Solutions(PegBoard p);
+	bool IsSolvable(PegBoard *p);
 
 	void ShowUnsolvableList(void);
+	void ShowSolutionList(void);
+	typeListOfPaths *GetSolutions(void);
+	void ClearSolutions(void);
+	bool SetLookUpBudget(size_t bytes, CACHEPOLICY policy);
+	LookUpCache *GetLookUpCache(void);
+
+	void ResetStatistics(void);
+	long long GetNumberOfSolutions(void);
+	long long GetNumberOfNoSolutions(void);
+	SearchArena *GetArena(void);
 };
 
@@ -0,0 +1,276 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <iostream>
+#include <new>
+#include "SearchArena.h"
+
+thread_local SearchArena *SearchArena::current = NULL;
+
+/// <summary>
+/// Constructor.  No memory is reserved until the first allocation.
+/// </summary>
+/// <param name=""></param>
+SearchArena::SearchArena(void) {
+	for (int i = 0; i <= ARENA_SIZE_CLASSES; i++)
+		freeList[i] = NULL;
+}
+
+/// <summary>
+/// Copy Constructor.  Blocks belong to exactly one arena, so a copy starts out as a new, empty arena.
+/// </summary>
+SearchArena::SearchArena(const SearchArena &) : SearchArena() {
+}
+
+/// <summary>
+/// Assignment keeps this arena's own memory (see the copy constructor).
+/// </summary>
+/// <returns></returns>
+SearchArena &SearchArena::operator=(const SearchArena &) {
+	return *this;
+}
+
+/// <summary>
+/// Destructor.  Returns every chunk to the heap.  Containers drawing from the arena must be destroyed first.
+/// </summary>
+/// <param name=""></param>
+SearchArena::~SearchArena(void) {
+	if (current == this)
+		current = NULL;
+	for (size_t i = 0; i < chunks.size(); i++)
+		::operator delete(chunks[i].memory);
+}
+
+/// <summary>
+/// SearchArena::Bump() carves a block out of the current chunk, moving on to the next chunk (or reserving a new one) when it is full.
+/// </summary>
+/// <param name="bytes">Size of the block, a multiple of ARENA_ALIGNMENT</param>
+/// <returns>Pointer to the block</returns>
+void *SearchArena::Bump(size_t bytes) {
+	while (currentChunk < chunks.size()) {
+		if (chunkOffset + bytes <= chunks[currentChunk].size) {
+			void *p = chunks[currentChunk].memory + chunkOffset;
+			chunkOffset += bytes;
+			return p;
+		}
+		currentChunk++;
+		chunkOffset = 0;
+	}
+
+	Chunk chunk;
+	chunk.size = (bytes > ARENA_CHUNK_SIZE) ? bytes : ARENA_CHUNK_SIZE;
+	chunk.memory = (char *) ::operator new(chunk.size);
+	chunks.push_back(chunk);
+	currentChunk = chunks.size() - 1;
+	chunkOffset = bytes;
+	return chunk.memory;
+}
+
+/// <summary>
+/// SearchArena::Allocate() hands out a block of at least the specified size, preferring a recycled block of the same size class.
+/// </summary>
+/// <param name="bytes">Requested size</param>
+/// <returns>Pointer to the usable part of the block</returns>
+void *SearchArena::Allocate(size_t bytes) {
+	size_t total = (sizeof(BlockHeader) + bytes + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+	size_t sizeClass = total / ARENA_ALIGNMENT;
+	BlockHeader *header;
+
+	if (sizeClass > ARENA_SIZE_CLASSES)
+		sizeClass = 0;	// too large to recycle; reclaimed by Reset()
+
+	if (sizeClass != 0 && freeList[sizeClass] != NULL) {
+		header = freeList[sizeClass];
+		freeList[sizeClass] = (BlockHeader *)header->arena;	// free blocks are chained through the header
+		numRecycled++;
+	}
+	else {
+		header = (BlockHeader *)Bump(total);
+	}
+
+	header->arena = this;
+	header->generation = generation;
+	header->sizeClass = (unsigned int)sizeClass;
+	numAllocations++;
+	numBytes += (long long)total;
+	numLive++;
+	return header + 1;
+}
+
+/// <summary>
+/// SearchArena::Reset() makes the whole arena available again in O(1), keeping the chunks for the next search.
+/// Blocks that are still in use are abandoned, so Reset() is only called when the arena is empty (see ArenaScope).
+/// </summary>
+/// <param name=""></param>
+void SearchArena::Reset(void) {
+	currentChunk = 0;
+	chunkOffset = 0;
+	for (int i = 0; i <= ARENA_SIZE_CLASSES; i++)
+		freeList[i] = NULL;
+	generation++;
+	numLive = 0;
+}
+
+/// <summary>
+/// SearchArena::ResetStatistics() clears the per-search allocation counters.
+/// </summary>
+/// <param name=""></param>
+void SearchArena::ResetStatistics(void) {
+	numAllocations = 0;
+	numRecycled = 0;
+	numBytes = 0;
+}
+
+/// <summary>
+/// SearchArena::IsEmpty() tells whether every block handed out since the last Reset() has been freed.
+/// </summary>
+/// <param name=""></param>
+/// <returns>true if no block is in use</returns>
+bool SearchArena::IsEmpty(void) {
+	return (numLive == 0);
+}
+
+/// <summary>
+/// SearchArena::GetNumberOfAllocations() returns the number of blocks handed out since the statistics were reset.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+long long SearchArena::GetNumberOfAllocations(void) {
+	return numAllocations;
+}
+
+/// <summary>
+/// SearchArena::GetNumberOfRecycled() returns the number of blocks served from a free list since the statistics were reset.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+long long SearchArena::GetNumberOfRecycled(void) {
+	return numRecycled;
+}
+
+/// <summary>
+/// SearchArena::GetNumberOfBytes() returns the number of bytes (headers included) handed out since the statistics were reset.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+long long SearchArena::GetNumberOfBytes(void) {
+	return numBytes;
+}
+
+/// <summary>
+/// SearchArena::GetReservedBytes() returns the number of bytes the arena holds from the heap.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+size_t SearchArena::GetReservedBytes(void) {
+	size_t total = 0;
+	for (size_t i = 0; i < chunks.size(); i++)
+		total += chunks[i].size;
+	return total;
+}
+
+/// <summary>
+/// SearchArena::ShowStatistics() displays the allocation counters of the last search.
+/// </summary>
+/// <param name=""></param>
+void SearchArena::ShowStatistics(void) {
+	std::cout << "Arena Allocations: " << numAllocations << " (" << numRecycled << " recycled, " << numBytes << " bytes)\n";
+	std::cout << "Arena Reserved Bytes: " << GetReservedBytes() << "\n";
+}
+
+/// <summary>
+/// SearchArena::AllocateFromCurrent() allocates from the current thread's arena, or from the heap if no arena is current.
+/// </summary>
+/// <param name="bytes">Requested size</param>
+/// <returns>Pointer to the usable part of the block</returns>
+void *SearchArena::AllocateFromCurrent(size_t bytes) {
+	if (current != NULL)
+		return current->Allocate(bytes);
+
+	BlockHeader *header = (BlockHeader *) ::operator new(sizeof(BlockHeader) + bytes);
+	header->arena = NULL;
+	header->generation = 0;
+	header->sizeClass = 0;
+	return header + 1;
+}
+
+/// <summary>
+/// SearchArena::Deallocate() frees a block obtained from AllocateFromCurrent() or Allocate().
+/// Arena blocks go back on their free list; blocks from before the arena's last Reset() are ignored.
+/// </summary>
+/// <param name="p">Block to free</param>
+void SearchArena::Deallocate(void *p) {
+	BlockHeader *header = (BlockHeader *)p - 1;
+	SearchArena *arena = header->arena;
+
+	if (arena == NULL) {
+		::operator delete(header);
+		return;
+	}
+	if (header->generation != arena->generation)
+		return;
+
+	arena->numLive--;
+	if (header->sizeClass != 0) {
+		header->arena = (SearchArena *)arena->freeList[header->sizeClass];
+		arena->freeList[header->sizeClass] = header;
+	}
+}
+
+/// <summary>
+/// SearchArena::GetCurrent() returns the arena used by ArenaAllocator on this thread.
+/// </summary>
+/// <param name=""></param>
+/// <returns></returns>
+SearchArena *SearchArena::GetCurrent(void) {
+	return current;
+}
+
+/// <summary>
+/// SearchArena::SetCurrent() selects the arena used by ArenaAllocator on this thread (NULL selects the heap).
+/// </summary>
+/// <param name="arena"></param>
+void SearchArena::SetCurrent(SearchArena *arena) {
+	current = arena;
+}
+
+/// <summary>
+/// Constructor.  Makes the arena current.  If it was not already current (i.e. this is the outermost scope) and reset is requested,
+/// the statistics are cleared and, when no block is still in use, the memory is reset as well.
+/// </summary>
+/// <param name="arena">Arena to make current</param>
+/// <param name="reset">Reset the arena when entering the outermost scope</param>
+ArenaScope::ArenaScope(SearchArena *arena, bool reset) {
+	previous = SearchArena::GetCurrent();
+	entered = (previous != arena);
+	if (entered) {
+		if (reset) {
+			arena->ResetStatistics();
+			if (arena->IsEmpty())
+				arena->Reset();
+		}
+		SearchArena::SetCurrent(arena);
+	}
+}
+
+/// <summary>
+/// Destructor.  Restores the arena that was current before the scope.
+/// </summary>
+/// <param name=""></param>
+ArenaScope::~ArenaScope(void) {
+	if (entered)
+		SearchArena::SetCurrent(previous);
+}
@@ -0,0 +1,117 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#define ARENA_CHUNK_SIZE (1 << 20)	// bytes taken from the heap at a time
+#define ARENA_ALIGNMENT 16	// every block (and its header) is a multiple of this
+#define ARENA_SIZE_CLASSES 16	// blocks of up to ARENA_SIZE_CLASSES * ARENA_ALIGNMENT bytes are recycled through free lists
+
+// SearchArena is a per-search node pool.  Blocks are bumped out of large chunks and, when freed, kept on a free list per size class
+// so the std::list nodes that the solver creates and destroys at every node are recycled without touching the heap.
+// Reset() makes all chunks available again in O(1); the chunks themselves are kept for the next search.
+//
+// Every block carries a small header naming its arena and the arena's generation, so a block can be freed by any container
+// without knowing where it came from, and blocks that were handed out before a Reset() are simply dropped instead of corrupting
+// the free lists.  An arena is not thread safe: its blocks must be allocated and freed on the thread that owns it.
+class SearchArena
+{
+private:
+	struct BlockHeader {
+		SearchArena *arena;	// owning arena, or NULL for blocks taken straight from the heap
+		unsigned int generation;	// arena generation the block was handed out in
+		unsigned int sizeClass;	// free list the block returns to (0 = not recycled)
+	};
+	struct Chunk {
+		char *memory;
+		size_t size;
+	};
+
+	std::vector <Chunk> chunks;	// chunks reserved from the heap, reused after Reset()
+	size_t currentChunk = 0;	// chunk currently being bumped
+	size_t chunkOffset = 0;	// bytes used in the current chunk
+	BlockHeader *freeList[ARENA_SIZE_CLASSES + 1];	// recycled blocks per size class
+	unsigned int generation = 0;	// incremented by Reset()
+
+	long long numAllocations = 0;	// blocks handed out since the statistics were reset
+	long long numRecycled = 0;	// blocks served from a free list
+	long long numBytes = 0;	// bytes handed out (including headers)
+	long long numLive = 0;	// blocks handed out and not yet freed
+
+	static thread_local SearchArena *current;	// arena used by ArenaAllocator on this thread
+
+	void *Bump(size_t bytes);
+
+public:
+	SearchArena(void);
+	SearchArena(const SearchArena &src);
+	SearchArena &operator=(const SearchArena &src);
+	~SearchArena(void);
+
+	void *Allocate(size_t bytes);
+	void Reset(void);
+	void ResetStatistics(void);
+	bool IsEmpty(void);
+
+	long long GetNumberOfAllocations(void);
+	long long GetNumberOfRecycled(void);
+	long long GetNumberOfBytes(void);
+	size_t GetReservedBytes(void);
+	void ShowStatistics(void);
+
+	static void *AllocateFromCurrent(size_t bytes);
+	static void Deallocate(void *p);
+	static SearchArena *GetCurrent(void);
+	static void SetCurrent(SearchArena *arena);
+};
+
+// ArenaScope makes an arena current for the lifetime of the scope.  Nested scopes on the same arena do nothing,
+// so it can be placed at the top of a recursive search; only the outermost scope resets the arena.
+class ArenaScope
+{
+private:
+	SearchArena *previous;
+	bool entered;
+
+public:
+	ArenaScope(SearchArena *arena, bool reset);
+	~ArenaScope(void);
+};
+
+// ArenaAllocator is a stateless STL allocator that draws from the current thread's SearchArena (or the heap when none is current).
+template <class T>
+class ArenaAllocator
+{
+public:
+	typedef T value_type;
+
+	ArenaAllocator(void) noexcept {}
+	template <class U> ArenaAllocator(const ArenaAllocator<U> &) noexcept {}
+
+	T *allocate(size_t n) {
+		return (T *)SearchArena::AllocateFromCurrent(n * sizeof(T));
+	}
+	void deallocate(T *p, size_t) noexcept {
+		SearchArena::Deallocate(p);
+	}
+};
+
+template <class T, class U>
+bool operator==(const ArenaAllocator<T> &, const ArenaAllocator<U> &) noexcept { return true; }
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T> &, const ArenaAllocator<U> &) noexcept { return false; }
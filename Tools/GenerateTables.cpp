@@ -0,0 +1,164 @@
+/*
+  CrackerBarrelPuzzle, a depth-first-search solver developed under C++
+
+  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  CrackerBarrelPuzzle is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// GenerateTables writes GeneratedTables.h: the tables of the standard (15-hole) geometry and the solvability of each of its boards,
+// so the solver starts with them instead of deriving them.  It must be built without the header it generates:
+//
+//   g++ -std=c++20 -O2 -DPEGBOARD_NO_GENERATED_TABLES -I. Tools/GenerateTables.cpp Geometry.cpp -o GenerateTables
+//   ./GenerateTables GeneratedTables.h
+//
+// Geometry::VerifyStandard() checks the generated tables against the same tables built at runtime.
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include "Geometry.h"
+
+/// <summary>
+/// WriteLicense() writes the license block that starts every source file.
+/// </summary>
+/// <param name="out">Stream to write to</param>
+static void WriteLicense(std::ostream &out) {
+	out << "/*\n"
+		"  CrackerBarrelPuzzle, a depth-first-search solver developed under C++\n"
+		"\n"
+		"  CrackerBarrelPuzzle is free software: you can redistribute it and/or modify\n"
+		"  it under the terms of the GNU General Public License as published by\n"
+		"  the Free Software Foundation, either version 3 of the License, or\n"
+		"  (at your option) any later version.\n"
+		"\n"
+		"  CrackerBarrelPuzzle is distributed in the hope that it will be useful,\n"
+		"  but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+		"  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+		"  GNU General Public License for more details.\n"
+		"\n"
+		"  You should have received a copy of the GNU General Public License\n"
+		"  along with this program.  If not, see <http://www.gnu.org/licenses/>.\n"
+		"*/\n";
+}
+
+/// <summary>
+/// WriteMasks() writes one mask per move as a C array.
+/// </summary>
+/// <param name="out">Stream to write to</param>
+/// <param name="name">Name of the array</param>
+/// <param name="masks">Masks to write</param>
+/// <param name="n">Number of masks</param>
+static void WriteMasks(std::ostream &out, const char *name, const typeBoardKey *masks, int n) {
+	out << "static const typeBoardKey " << name << "[GENERATED_NUMBER_OF_MOVES] = {";
+	for (int i = 0; i < n; i++)
+		out << ((i % 8 == 0) ? "\n\t" : " ") << "0x" << std::hex << masks[i] << std::dec << ((i + 1 < n) ? "," : "");
+	out << " };\n\n";
+}
+
+/// <summary>
+/// WriteTables() writes the tables of a geometry, which must have its solvability table, as GeneratedTables.h.
+/// </summary>
+/// <param name="out">Stream to write to</param>
+/// <param name="g">Geometry to write</param>
+static void WriteTables(std::ostream &out, const Geometry &g) {
+	int holes = g.GetNumberOfHoles();
+	int moves = g.GetNumberOfMoves();
+	const std::vector <unsigned long long> &solvable = g.GetSolvabilityTable();
+
+	WriteLicense(out);
+	out << "// Generated by Tools/GenerateTables.cpp -- do not edit.  Included by Geometry.cpp only.\n";
+	out << "#pragma once\n";
+	out << "#include \"Geometry.h\"\n\n";
+	out << "#define GENERATED_NAME \"" << g.GetName() << "\"\n";
+	out << "#define GENERATED_NUMBER_OF_HOLES " << holes << "\n";
+	out << "#define GENERATED_NUMBER_OF_MOVES " << moves << "\n";
+	out << "#define GENERATED_NUMBER_OF_SYMMETRIES " << g.GetNumberOfSymmetries() << "\n";
+	out << "#define GENERATED_SOLVABLE_WORDS " << solvable.size() << "\n\n";
+
+	out << "// Moves as { from, to, jump }, sorted by (from, to)\n";
+	out << "static const Move GeneratedMoves[GENERATED_NUMBER_OF_MOVES] = {";
+	for (int i = 0; i < moves; i++) {
+		Move m = g.GetMove(i);
+		out << ((i % 6 == 0) ? "\n\t" : " ") << "{ " << m.from << ", " << m.to << ", " << m.jump << " }" << ((i + 1 < moves) ? "," : "");
+	}
+	out << " };\n\n";
+
+	WriteMasks(out, "GeneratedFromJumpMasks", g.GetFromJumpMasks(), moves);
+	WriteMasks(out, "GeneratedToMasks", g.GetToMasks(), moves);
+	WriteMasks(out, "GeneratedMoveMasks", g.GetMoveMasks(), moves);
+
+	out << "// [from * GENERATED_NUMBER_OF_HOLES + to] is the move from <from> to <to>, or -1\n";
+	out << "static const short GeneratedMoveIndex[GENERATED_NUMBER_OF_HOLES * GENERATED_NUMBER_OF_HOLES] = {";
+	for (int from = 0; from < holes; from++) {
+		out << "\n\t";
+		for (int to = 0; to < holes; to++)
+			out << ((to > 0) ? ", " : "") << g.GetMoveIndex(from, to);
+		out << ((from + 1 < holes) ? "," : "");
+	}
+	out << " };\n\n";
+
+	out << "// Moves in which hole h is the from, jump or to hole: GeneratedMovesOfHole[GeneratedMovesOfHoleStart[h]] up to GeneratedMovesOfHoleStart[h + 1]\n";
+	out << "static const int GeneratedMovesOfHoleStart[GENERATED_NUMBER_OF_HOLES + 1] = {";
+	int start = 0;
+	for (int h = 0; h <= holes; h++) {
+		out << " " << start << ((h < holes) ? "," : "");
+		if (h < holes)
+			start += (int)g.GetMovesOfHole(h).size();
+	}
+	out << " };\n";
+	out << "static const int GeneratedMovesOfHole[" << start << "] = {";
+	for (int h = 0; h < holes; h++) {
+		const std::vector <int> &list = g.GetMovesOfHole(h);
+		out << "\n\t";
+		for (size_t k = 0; k < list.size(); k++)
+			out << ((k > 0) ? ", " : "") << list[k];
+		out << ((h + 1 < holes) ? "," : "");
+	}
+	out << " };\n\n";
+
+	out << "// Hole i is mapped to hole GeneratedSymmetries[s][i] by symmetry s\n";
+	out << "static const unsigned char GeneratedSymmetries[GENERATED_NUMBER_OF_SYMMETRIES][GENERATED_NUMBER_OF_HOLES] = {";
+	for (int s = 0; s < g.GetNumberOfSymmetries(); s++) {
+		out << "\n\t{ ";
+		for (int i = 0; i < holes; i++)
+			out << (int)g.GetSymmetry(s).image[i] << ((i + 1 < holes) ? ", " : " }");
+		out << ((s + 1 < g.GetNumberOfSymmetries()) ? "," : "");
+	}
+	out << " };\n\n";
+
+	out << "// Bit k % 64 of word k / 64 is set when board k can be reduced to a single peg\n";
+	out << "static const unsigned long long GeneratedSolvable[GENERATED_SOLVABLE_WORDS] = {";
+	for (size_t i = 0; i < solvable.size(); i++)
+		out << ((i % 4 == 0) ? "\n\t" : " ") << "0x" << std::hex << std::setw(16) << std::setfill('0') << solvable[i] << std::dec << "ULL" << ((i + 1 < solvable.size()) ? "," : "");
+	out << " };\n";
+}
+
+int main(int argc, char **argv)
+{
+	Geometry standard = Geometry::Triangle(5);
+	if (!standard.BuildSolvabilityTable()) {
+		std::cerr << "The solvability table cannot be built for " << standard.GetName() << "\n";
+		return 1;
+	}
+
+	if (argc < 2) {
+		WriteTables(std::cout, standard);
+		return 0;
+	}
+	std::ofstream file(argv[1], std::ios::binary);
+	if (!file) {
+		std::cerr << argv[1] << ": cannot create the file\n";
+		return 1;
+	}
+	WriteTables(file, standard);
+	return file ? 0 : 1;
+}